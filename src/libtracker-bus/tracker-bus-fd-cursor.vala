@@ -18,6 +18,11 @@
  */
 
 class Tracker.Bus.FDCursor : Tracker.Sparql.Cursor {
+	/* The whole result stream is spliced off the pipe into this
+	 * buffer before the cursor is handed out (see tracker-bus.vala),
+	 * so next() never touches the pipe: the store streams at full
+	 * speed into the kernel buffer while the splice drains it, and
+	 * iteration afterwards is pointer arithmetic over memory. */
 	internal char* buffer;
 	internal ulong buffer_index;
 	internal ulong buffer_size;
@@ -36,8 +36,13 @@
 typedef struct _TrackerLanguagePriv TrackerLanguagePriv;
 typedef struct _Languages           Languages;
 
+/* First-byte occurrence bitmaps per word length; most tokens fail
+ * this filter and skip the hash probe entirely. */
+#define STOP_WORD_MAX_LEN 32
+
 struct _TrackerLanguagePriv {
 	GHashTable    *stop_words;
+	guint32        stop_word_filter[STOP_WORD_MAX_LEN + 1];
 	gboolean       enable_stemmer;
 	gchar         *language_code;
 
@@ -275,9 +280,15 @@ language_add_stopwords (TrackerLanguage *language,
 
 	/* FIXME: Shouldn't clear the hash table first? */
 	for (p = words; *p; p++) {
+		const gchar *word = g_strstrip (*p);
+		gsize len = strlen (word);
+
 		g_hash_table_insert (priv->stop_words,
-		                     g_strdup (g_strstrip (*p)),
+		                     g_strdup (word),
 		                     GINT_TO_POINTER (1));
+
+		priv->stop_word_filter[MIN (len, STOP_WORD_MAX_LEN)] |=
+			1u << (((guchar) word[0]) & 31);
 	}
 
 	g_strfreev (words);
@@ -413,12 +424,21 @@ tracker_language_is_stop_word (TrackerLanguage *language,
                                const gchar     *word)
 {
 	TrackerLanguagePriv *priv;
+	gsize len;
 
 	g_return_val_if_fail (TRACKER_IS_LANGUAGE (language), FALSE);
 	g_return_val_if_fail (word, FALSE);
 
 	priv = GET_PRIV (language);
 
+	len = strlen (word);
+
+	/* cheap negative filter first, stop words are few and short */
+	if ((priv->stop_word_filter[MIN (len, STOP_WORD_MAX_LEN)] &
+	     (1u << (((guchar) word[0]) & 31))) == 0) {
+		return FALSE;
+	}
+
 	return g_hash_table_lookup (priv->stop_words, word) != NULL;
 }
 
@@ -62,6 +62,10 @@ struct TrackerParser {
 	gint                   word_length;
 	guint                  word_position;
 
+	/* UTF-8 <-> UChar converter, kept for the parser's lifetime;
+	 * opening one per token shows up in profiles */
+	UConverter            *converter;
+
 	/* Text as UChars */
 	UChar                 *utxt;
 	gint                   utxt_size;
@@ -207,26 +211,19 @@ tracker_parser_unaccent_nfkd_string (gpointer  str,
 }
 
 static gchar *
-convert_UChar_to_utf8 (const UChar *word,
+convert_UChar_to_utf8 (UConverter  *converter,
+                       const UChar *word,
                        gsize        uchar_len,
                        gsize       *utf8_len)
 {
 	gchar *utf8_str;
 	UErrorCode icu_error = U_ZERO_ERROR;
-	UConverter *converter;
 	gsize new_utf8_len;
 
+	g_return_val_if_fail (converter, NULL);
 	g_return_val_if_fail (word, NULL);
 	g_return_val_if_fail (utf8_len, NULL);
 
-	/* Open converter UChar to UTF-16BE */
-	converter = ucnv_open ("UTF-8", &icu_error);
-	if (!converter) {
-		g_warning ("Cannot open UTF-8 converter: '%s'",
-		           U_FAILURE (icu_error) ? u_errorName (icu_error) : "none");
-		return NULL;
-	}
-
 	/* A character encoded in 2 bytes in UTF-16 may get expanded to 3 or 4 bytes
 	 *  in UTF-8. */
 	utf8_str = g_malloc (2 * uchar_len * sizeof (UChar) + 1);
@@ -242,12 +239,10 @@ convert_UChar_to_utf8 (const UChar *word,
 		g_warning ("Cannot convert from UChar to UTF-8: '%s'",
 		           u_errorName (icu_error));
 		g_free (utf8_str);
-		ucnv_close (converter);
 		return NULL;
 	}
 
 	*utf8_len = new_utf8_len;
-	ucnv_close (converter);
 
 	return utf8_str;
 }
@@ -269,8 +264,24 @@ process_word_uchar (TrackerParser         *parser,
 	                            (guint8 *)word,
 	                            length * sizeof (UChar));
 
+	if (type == TRACKER_PARSER_WORD_TYPE_ASCII) {
+		/* ASCII fast path: every UChar is a single byte, lowercase
+		 * it directly into the output buffer without going through
+		 * ICU case mapping, normalization or charset conversion. */
+		gint i;
 
-	if (type != TRACKER_PARSER_WORD_TYPE_ASCII) {
+		utf8_str = g_malloc (length + 1);
+		for (i = 0; i < length; i++) {
+			utf8_str[i] = g_ascii_tolower ((gchar) word[i]);
+		}
+		utf8_str[length] = '\0';
+		new_word_length = length;
+
+		/* Log after lowercase */
+		tracker_parser_message_hex (" After lowercase",
+		                            utf8_str,
+		                            new_word_length);
+	} else {
 		UChar casefolded_buffer [WORD_BUFFER_LENGTH];
 
 		/* Casefold... */
@@ -314,46 +325,29 @@ process_word_uchar (TrackerParser         *parser,
 		tracker_parser_message_hex (" After Normalization",
 		                            (guint8 *) normalized_buffer,
 		                            new_word_length * sizeof (UChar));
-	} else {
-		/* For ASCII-only, just tolower() each character */
-		new_word_length = u_strToLower (normalized_buffer,
-		                                WORD_BUFFER_LENGTH,
-		                                word,
-		                                length,
-		                                NULL,
-		                                &error);
-		if (U_FAILURE (error)) {
-			g_warning ("Error lowercasing: '%s'",
-			           u_errorName (error));
-			return NULL;
+
+		/* UNAC stripping needed? (for non-CJK and non-ASCII) */
+		if (parser->enable_unaccent &&
+		    type == TRACKER_PARSER_WORD_TYPE_OTHER_UNAC &&
+		    tracker_parser_unaccent_nfkd_string (normalized_buffer, &new_word_length)) {
+			/* Log after unaccenting */
+			tracker_parser_message_hex ("  After UNAC",
+			                            (guint8 *) normalized_buffer,
+			                            new_word_length * sizeof (UChar));
 		}
 
-		/* Log after casefolding */
-		tracker_parser_message_hex (" After lowercase",
-		                            (guint8 *) normalized_buffer,
-		                            new_word_length * sizeof (UChar));
-	}
+		/* Finally, convert to UTF-8 */
+		utf8_str = convert_UChar_to_utf8 (parser->converter,
+		                                  normalized_buffer,
+		                                  new_word_length,
+		                                  &new_word_length);
 
-	/* UNAC stripping needed? (for non-CJK and non-ASCII) */
-	if (parser->enable_unaccent &&
-	    type == TRACKER_PARSER_WORD_TYPE_OTHER_UNAC &&
-	    tracker_parser_unaccent_nfkd_string (normalized_buffer, &new_word_length)) {
 		/* Log after unaccenting */
-		tracker_parser_message_hex ("  After UNAC",
-		                            (guint8 *) normalized_buffer,
-		                            new_word_length * sizeof (UChar));
+		tracker_parser_message_hex ("   After UTF8 conversion",
+		                            utf8_str,
+		                            new_word_length);
 	}
 
-	/* Finally, convert to UTF-8 */
-	utf8_str = convert_UChar_to_utf8 (normalized_buffer,
-	                                  new_word_length,
-	                                  &new_word_length);
-
-	/* Log after unaccenting */
-	tracker_parser_message_hex ("   After UTF8 conversion",
-	                            utf8_str,
-	                            new_word_length);
-
 	/* Check if stop word */
 	if (parser->ignore_stop_words) {
 		*stop_word = tracker_language_is_stop_word (parser->language,
@@ -592,6 +586,10 @@ tracker_parser_free (TrackerParser *parser)
 		ubrk_close (parser->bi);
 	}
 
+	if (parser->converter) {
+		ucnv_close (parser->converter);
+	}
+
 	g_free (parser->utxt);
 	g_free (parser->offsets);
 
@@ -612,7 +610,6 @@ tracker_parser_reset (TrackerParser *parser,
                       gboolean       ignore_numbers)
 {
 	UErrorCode error = U_ZERO_ERROR;
-	UConverter *converter;
 	UChar *last_uchar;
 	const gchar *last_utf8;
 
@@ -653,14 +650,19 @@ tracker_parser_reset (TrackerParser *parser,
 	if (parser->txt_size == 0)
 		return;
 
-	/* Open converter UTF-8 to UChar */
-	converter = ucnv_open ("UTF-8", &error);
-	if (!converter) {
-		g_warning ("Cannot open UTF-8 converter: '%s'",
-		           U_FAILURE (error) ? u_errorName (error) : "none");
-		return;
+	/* Open converter UTF-8 to UChar, reused across resets and for
+	 * the per-word conversions back to UTF-8 */
+	if (!parser->converter) {
+		parser->converter = ucnv_open ("UTF-8", &error);
+		if (!parser->converter) {
+			g_warning ("Cannot open UTF-8 converter: '%s'",
+			           U_FAILURE (error) ? u_errorName (error) : "none");
+			return;
+		}
 	}
 
+	ucnv_reset (parser->converter);
+
 	/* Allocate UChars and offsets buffers */
 	parser->utxt_size = txt_size + 1;
 	parser->utxt = g_malloc (parser->utxt_size * sizeof (UChar));
@@ -671,7 +673,7 @@ tracker_parser_reset (TrackerParser *parser,
 	last_utf8 = parser->txt;
 
 	/* Convert to UChars storing offsets */
-	ucnv_toUnicode (converter,
+	ucnv_toUnicode (parser->converter,
 	                &last_uchar,
 	                &parser->utxt[txt_size],
 	                &last_utf8,
@@ -711,8 +713,6 @@ tracker_parser_reset (TrackerParser *parser,
 		}
 	}
 
-	/* Close converter */
-	ucnv_close (converter);
 }
 
 const gchar *
@@ -28,6 +28,10 @@
 
 #include "tracker-miner-manager.h"
 
+/* Status snapshot calls should degrade, not hang, when a miner's
+ * main loop is busy crawling */
+#define STATUS_CALL_TIMEOUT_MS 2000
+
 /**
  * SECTION:tracker-miner-manager
  * @short_description: External control and monitoring of miners
@@ -1164,7 +1168,7 @@ tracker_miner_manager_get_status (TrackerMinerManager  *manager,
 		                            "GetProgress",
 		                            NULL,
 		                            G_DBUS_CALL_FLAGS_NONE,
-		                            -1,
+		                            STATUS_CALL_TIMEOUT_MS,
 		                            NULL,
 		                            &error);
 		if (error) {
@@ -1193,7 +1197,7 @@ tracker_miner_manager_get_status (TrackerMinerManager  *manager,
 		                            "GetStatus",
 		                            NULL,
 		                            G_DBUS_CALL_FLAGS_NONE,
-		                            -1,
+		                            STATUS_CALL_TIMEOUT_MS,
 		                            NULL,
 		                            &error);
 		if (error) {
@@ -1215,7 +1219,7 @@ tracker_miner_manager_get_status (TrackerMinerManager  *manager,
 		                            "GetRemainingTime",
 		                            NULL,
 		                            G_DBUS_CALL_FLAGS_NONE,
-		                            -1,
+		                            STATUS_CALL_TIMEOUT_MS,
 		                            NULL,
 		                            &error);
 		if (error) {
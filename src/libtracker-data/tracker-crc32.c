@@ -81,15 +81,71 @@ static const guint32 crcTable[256] = {
   0xB3667A2EUL, 0xC4614AB8UL, 0x5D681B02UL, 0x2A6F2B94UL, 0xB40BBE37UL, 0xC30C8EA1UL, 0x5A05DF1BUL, 0x2D02EF8DUL
 };
 
+/* Slicing-by-8 tables derived from crcTable at first use; same
+ * polynomial, so checksums stay identical to the byte-wise variant
+ * (and to existing journals), but eight input bytes are consumed per
+ * iteration instead of one. */
+static guint32 crcTable8[8][256];
+static gsize crc_tables_initialized = 0;
+
+static void
+init_crc_tables (void)
+{
+  guint i, k;
+
+  for (i = 0; i < 256; i++) {
+    guint32 c = crcTable[i];
+
+    crcTable8[0][i] = c;
+    for (k = 1; k < 8; k++) {
+      c = crcTable[c & 0xFF] ^ (c >> 8);
+      crcTable8[k][i] = c;
+    }
+  }
+}
+
 guint32
 tracker_crc32 (gconstpointer ptr, gsize len)
 {
   guint32 crc = 0xFFFFFFFF;
   const guint8 *bp = (const guint8 *) ptr;
-  size_t i;
 
-  for (i=0; i<len; i++)
-    crc = crcTable[(crc ^ bp[i]) & 0xFF] ^ (crc >> 8);
+  if (g_once_init_enter (&crc_tables_initialized)) {
+    init_crc_tables ();
+    g_once_init_leave (&crc_tables_initialized, 1);
+  }
+
+  while (len >= 8) {
+    guint32 one, two;
+
+    /* assemble little-endian words explicitly, so the result does
+     * not depend on host byte order */
+    one = (guint32) bp[0] |
+          (guint32) bp[1] << 8 |
+          (guint32) bp[2] << 16 |
+          (guint32) bp[3] << 24;
+    two = (guint32) bp[4] |
+          (guint32) bp[5] << 8 |
+          (guint32) bp[6] << 16 |
+          (guint32) bp[7] << 24;
+
+    one ^= crc;
+
+    crc = crcTable8[7][one & 0xFF] ^
+          crcTable8[6][(one >> 8) & 0xFF] ^
+          crcTable8[5][(one >> 16) & 0xFF] ^
+          crcTable8[4][one >> 24] ^
+          crcTable8[3][two & 0xFF] ^
+          crcTable8[2][(two >> 8) & 0xFF] ^
+          crcTable8[1][(two >> 16) & 0xFF] ^
+          crcTable8[0][two >> 24];
+
+    bp += 8;
+    len -= 8;
+  }
+
+  while (len--)
+    crc = crcTable[(crc ^ *bp++) & 0xFF] ^ (crc >> 8);
 
   return crc ^ 0xFFFFFFFF;
 }
@@ -123,6 +123,17 @@ handle_unsupported_ontology_change (const gchar  *ontology_path,
 	tracker_db_manager_remove_version_file ();
 #endif /* DISABLE_JOURNAL */
 
+	/* Make the expensive consequence and its exact trigger stand
+	 * out in the log; a full rebuild is otherwise easy to blame on
+	 * the wrong ontology tweak. */
+	g_warning ("Ontology change in %s for %s (%s: old=%s, attempted new=%s) "
+	           "cannot be applied in place, a full reindex will happen on restart",
+	           ontology_path != NULL ? ontology_path : "Unknown",
+	           subject != NULL ? subject : "Unknown",
+	           change != NULL ? change : "Unknown",
+	           old != NULL ? old : "Unknown",
+	           attempted_new != NULL ? attempted_new : "Unknown");
+
 	g_set_error (error, TRACKER_DATA_ONTOLOGY_ERROR,
 	             TRACKER_DATA_UNSUPPORTED_ONTOLOGY_CHANGE,
 	             "%s: Unsupported ontology change for %s: can't change %s (old=%s, attempted new=%s)",
@@ -3645,11 +3656,16 @@ static void
 rebuild_fts_tokens (TrackerDBInterface *iface)
 {
 	g_debug ("Rebuilding FTS tokens, this may take a moment...");
-	tracker_db_interface_sqlite_fts_rebuild_tokens (iface);
+	if (!tracker_db_interface_sqlite_fts_rebuild_tokens (iface)) {
+		/* leave the stamp file alone so the rebuild is retried
+		 * on the next start */
+		return;
+	}
 	g_debug ("FTS tokens rebuilt");
 
 	/* Update the stamp file */
 	tracker_db_manager_tokenizer_update ();
+	tracker_db_manager_set_fts_dirty (FALSE);
 }
 #endif
 
@@ -4050,7 +4066,10 @@ tracker_data_manager_init (TrackerDBManagerFlags   flags,
 			}
 #endif /* DISABLE_JOURNAL */
 
-			/* Load ontology from database into memory */
+			/* Load ontology from database into memory. The gvdb
+			 * cache is only trusted on read-only starts; writers
+			 * must see exactly what the database holds since they
+			 * may be about to change it. */
 			db_get_static_data (iface, &internal_error);
 			check_ontology = (flags & TRACKER_DB_MANAGER_DO_NOT_CHECK_ONTOLOGY) == 0;
 
@@ -4634,7 +4653,12 @@ tracker_data_manager_init (TrackerDBManagerFlags   flags,
 
 #if HAVE_TRACKER_FTS
 		rebuild_fts_tokens (iface);
-	} else if (!read_only && tracker_db_manager_get_tokenizer_changed ()) {
+	} else if (!read_only &&
+	           (tracker_db_manager_get_tokenizer_changed () ||
+	            tracker_db_manager_get_fts_dirty ())) {
+		/* the dirty marker means the last run died with deferred
+		 * FTS work pending; the text is only recoverable by
+		 * rebuilding the tokens from the stored content */
 		rebuild_fts_tokens (iface);
 #endif
 	}
@@ -4678,6 +4702,10 @@ tracker_data_manager_shutdown (void)
 
 	tracker_db_manager_shutdown ();
 	tracker_ontologies_shutdown ();
+
+	/* cached SELECT translations refer to this schema generation */
+	tracker_sparql_query_clear_translation_cache ();
+
 	if (!reloading) {
 		tracker_locale_shutdown ();
 	}
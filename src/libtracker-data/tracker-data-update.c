@@ -39,6 +39,13 @@
 #include "tracker-property.h"
 #include "tracker-sparql-query.h"
 
+/* How many journal transactions are coalesced into one SQLite
+ * transaction during journal replay. Each journal transaction is
+ * bracketed by a savepoint, so a torn journal tail only ever costs
+ * the partial transaction itself, exactly like per-transaction
+ * replay did. */
+#define REPLAY_TRANSACTION_BATCH_SIZE 100
+
 typedef struct _TrackerDataUpdateBuffer TrackerDataUpdateBuffer;
 typedef struct _TrackerDataUpdateBufferResource TrackerDataUpdateBufferResource;
 typedef struct _TrackerDataUpdateBufferPredicate TrackerDataUpdateBufferPredicate;
@@ -56,6 +63,11 @@ struct _TrackerDataUpdateBuffer {
 	/* integer -> TrackerDataUpdateBufferResource */
 	GHashTable *resources_by_id;
 
+	/* arena for the small strings referenced by the resource buffers
+	 * (subjects, table names); freed in one shot when the buffer is
+	 * emptied instead of one malloc/free pair per string */
+	GStringChunk *chunk;
+
 	/* the following two fields are valid per sqlite transaction, not just for same subject */
 	/* TrackerClass -> integer */
 	GHashTable *class_counts;
@@ -145,12 +157,115 @@ static time_t resource_time = 0;
 static gint transaction_modseq = 0;
 static gboolean has_persistent = TRUE;
 
+/* Group commit: with limits set, independent update transactions share
+ * one SQLite transaction and a single journal fsync. Journal entries
+ * are still written per logical update, so the on-disk format does not
+ * change. */
+static guint group_commit_max_updates = 0;
+static guint group_commit_max_latency = 0; /* in milliseconds */
+static guint group_commit_pending = 0;
+static gint64 group_commit_start_time = 0;
+static gsize group_commit_journal_size = 0;
+static gboolean group_commit_has_persistent = FALSE;
+/* set when the journal rotated while the group was open */
+static gboolean group_commit_rotated = FALSE;
+
 static GPtrArray *insert_callbacks = NULL;
 static GPtrArray *delete_callbacks = NULL;
 static GPtrArray *commit_callbacks = NULL;
 static GPtrArray *rollback_callbacks = NULL;
 static gint max_service_id = 0;
 static gint max_ontology_id = 0;
+/* resources buffered before the update buffer is flushed; raised
+ * during bulk load where larger batches amortize the per-flush cost */
+static guint update_buffer_limit = 1000;
+static gboolean in_bulk_load = FALSE;
+
+/* The URI -> ID cache survives transaction boundaries (IDs are never
+ * reassigned, only a rollback can invalidate fresh entries) and is
+ * emptied wholesale when it outgrows this bound. */
+#define RESOURCE_CACHE_MAX_SIZE 50000
+static guint64 resource_cache_hits = 0;
+static guint64 resource_cache_misses = 0;
+
+#if HAVE_TRACKER_FTS
+/* Deferred FTS: with deferral enabled, tokenization is taken off the
+ * commit path. FTS text updates are staged per transaction, moved to
+ * the work queue at commit (dropped on rollback) and applied in
+ * batches from tracker_data_process_deferred_fts(). */
+typedef struct {
+	gint id;
+	/* property names, NULL-terminated, borrowed from the ontology */
+	GPtrArray *properties;
+	/* text per property, NULL-terminated, owned */
+	GPtrArray *text;
+} DeferredFtsUpdate;
+
+static gboolean fts_deferred = FALSE;
+static GQueue deferred_fts_queue = G_QUEUE_INIT;
+static GQueue deferred_fts_staging = G_QUEUE_INIT;
+/* mirrors the on-disk dirty marker that forces a token rebuild when
+ * the process dies with FTS work still pending */
+static gboolean fts_dirty_marked = FALSE;
+
+static void
+deferred_fts_update_dirty_marker (void)
+{
+	if (!fts_dirty_marked &&
+	    (!g_queue_is_empty (&deferred_fts_staging) ||
+	     !g_queue_is_empty (&deferred_fts_queue))) {
+		tracker_db_manager_set_fts_dirty (TRUE);
+		fts_dirty_marked = TRUE;
+	} else if (fts_dirty_marked &&
+	           g_queue_is_empty (&deferred_fts_staging) &&
+	           g_queue_is_empty (&deferred_fts_queue)) {
+		tracker_db_manager_set_fts_dirty (FALSE);
+		fts_dirty_marked = FALSE;
+	}
+}
+
+static void
+deferred_fts_update_free (DeferredFtsUpdate *update)
+{
+	g_ptr_array_free (update->properties, TRUE);
+	g_ptr_array_free (update->text, TRUE);
+	g_slice_free (DeferredFtsUpdate, update);
+}
+
+/* A delete must not be overtaken by a queued insert for the same
+ * resource, drop any pending text for it */
+static void
+deferred_fts_purge (gint id)
+{
+	GList *l, *next;
+
+	for (l = deferred_fts_staging.head; l; l = next) {
+		next = l->next;
+		if (((DeferredFtsUpdate *) l->data)->id == id) {
+			deferred_fts_update_free (l->data);
+			g_queue_delete_link (&deferred_fts_staging, l);
+		}
+	}
+
+	for (l = deferred_fts_queue.head; l; l = next) {
+		next = l->next;
+		if (((DeferredFtsUpdate *) l->data)->id == id) {
+			deferred_fts_update_free (l->data);
+			g_queue_delete_link (&deferred_fts_queue, l);
+		}
+	}
+}
+
+static void
+deferred_fts_clear (GQueue *queue)
+{
+	DeferredFtsUpdate *update;
+
+	while ((update = g_queue_pop_head (queue)) != NULL) {
+		deferred_fts_update_free (update);
+	}
+}
+#endif /* HAVE_TRACKER_FTS */
 
 static gint         ensure_resource_id         (const gchar      *uri,
                                                 gboolean         *create);
@@ -524,7 +639,9 @@ cache_ensure_table (const gchar *table_name,
 	table = g_hash_table_lookup (resource_buffer->tables, table_name);
 	if (table == NULL) {
 		table = cache_table_new (multiple_values);
-		g_hash_table_insert (resource_buffer->tables, g_strdup (table_name), table);
+		g_hash_table_insert (resource_buffer->tables,
+		                     g_string_chunk_insert (update_buffer.chunk, table_name),
+		                     table);
 		table->insert = multiple_values;
 	}
 
@@ -604,6 +721,19 @@ cache_delete_value (const gchar            *table_name,
 	g_array_append_val (table->properties, property);
 }
 
+static void
+resource_cache_insert (const gchar *uri,
+                       gint         id)
+{
+	/* size bound: wholesale eviction is cheap and the hot working
+	 * set re-populates within a transaction or two */
+	if (g_hash_table_size (update_buffer.resource_cache) >= RESOURCE_CACHE_MAX_SIZE) {
+		g_hash_table_remove_all (update_buffer.resource_cache);
+	}
+
+	g_hash_table_insert (update_buffer.resource_cache, g_strdup (uri), GINT_TO_POINTER (id));
+}
+
 static gint
 query_resource_id (const gchar *uri)
 {
@@ -612,11 +742,15 @@ query_resource_id (const gchar *uri)
 	id = GPOINTER_TO_INT (g_hash_table_lookup (update_buffer.resource_cache, uri));
 
 	if (id == 0) {
+		resource_cache_misses++;
+
 		id = tracker_data_query_resource_id (uri);
 
 		if (id) {
-			g_hash_table_insert (update_buffer.resource_cache, g_strdup (uri), GINT_TO_POINTER (id));
+			resource_cache_insert (uri, id);
 		}
+	} else {
+		resource_cache_hits++;
 	}
 
 	return id;
@@ -662,7 +796,7 @@ ensure_resource_id (const gchar *uri,
 		}
 #endif /* DISABLE_JOURNAL */
 
-		g_hash_table_insert (update_buffer.resource_cache, g_strdup (uri), GINT_TO_POINTER (id));
+		resource_cache_insert (uri, id);
 	}
 
 	return id;
@@ -978,13 +1112,26 @@ tracker_data_resource_buffer_flush (GError **error)
 			g_ptr_array_add (properties, NULL);
 			g_ptr_array_add (text, NULL);
 
-			tracker_db_interface_sqlite_fts_update_text (iface,
-			                                             resource_buffer->id,
-			                                             (const gchar **) properties->pdata,
-			                                             (const gchar **) text->pdata);
+			if (fts_deferred && !in_journal_replay) {
+				DeferredFtsUpdate *update;
+
+				update = g_slice_new (DeferredFtsUpdate);
+				update->id = resource_buffer->id;
+				update->properties = properties;
+				update->text = text;
+				g_queue_push_tail (&deferred_fts_staging, update);
+				/* marker goes to disk before the transaction can
+				 * commit, so a crash always leaves it behind */
+				deferred_fts_update_dirty_marker ();
+			} else {
+				tracker_db_interface_sqlite_fts_update_text (iface,
+				                                             resource_buffer->id,
+				                                             (const gchar **) properties->pdata,
+				                                             (const gchar **) text->pdata);
+				g_ptr_array_free (properties, TRUE);
+				g_ptr_array_free (text, TRUE);
+			}
 			update_buffer.fts_ever_updated = TRUE;
-			g_ptr_array_free (properties, TRUE);
-			g_ptr_array_free (text, TRUE);
 		}
 	}
 #endif
@@ -1032,6 +1179,12 @@ tracker_data_update_buffer_flush (GError **error)
 		g_hash_table_remove_all (update_buffer.resources);
 	}
 	resource_buffer = NULL;
+
+	if (update_buffer.chunk) {
+		/* both resource tables are empty now, release their strings
+		 * in one shot */
+		g_string_chunk_clear (update_buffer.chunk);
+	}
 }
 
 void
@@ -1039,7 +1192,7 @@ tracker_data_update_buffer_might_flush (GError **error)
 {
 	/* avoid high memory usage by update buffer */
 	if (g_hash_table_size (update_buffer.resources) +
-	    g_hash_table_size (update_buffer.resources_by_id) >= 1000) {
+	    g_hash_table_size (update_buffer.resources_by_id) >= update_buffer_limit) {
 		tracker_data_update_buffer_flush (error);
 	}
 }
@@ -1052,8 +1205,15 @@ tracker_data_update_buffer_clear (void)
 	g_hash_table_remove_all (update_buffer.resource_cache);
 	resource_buffer = NULL;
 
+	if (update_buffer.chunk) {
+		g_string_chunk_clear (update_buffer.chunk);
+	}
+
 #if HAVE_TRACKER_FTS
 	update_buffer.fts_ever_updated = FALSE;
+	/* FTS work staged by the aborted transaction goes with it */
+	deferred_fts_clear (&deferred_fts_staging);
+	deferred_fts_update_dirty_marker ();
 #endif
 
 	if (update_buffer.class_counts) {
@@ -2085,6 +2245,7 @@ cache_delete_resource_type_full (TrackerClass *class,
 		if (strcmp (tracker_class_get_uri (class), TRACKER_PREFIX_RDFS "Resource") == 0 &&
 		    g_hash_table_size (resource_buffer->tables) == 0) {
 #if HAVE_TRACKER_FTS
+			deferred_fts_purge (resource_buffer->id);
 			tracker_db_interface_sqlite_fts_delete_id (iface, resource_buffer->id);
 #endif
 			/* skip subclass query when deleting whole resource
@@ -2315,7 +2476,7 @@ resource_buffer_switch (const gchar *graph,
 		/* subject not yet in cache, retrieve or create ID */
 		resource_buffer = g_slice_new0 (TrackerDataUpdateBufferResource);
 		if (subject != NULL) {
-			subject_dup = g_strdup (subject);
+			subject_dup = g_string_chunk_insert (update_buffer.chunk, subject);
 			resource_buffer->subject = subject_dup;
 		}
 		if (subject_id > 0) {
@@ -2332,7 +2493,8 @@ resource_buffer_switch (const gchar *graph,
 			resource_buffer->types = tracker_data_query_rdf_type (resource_buffer->id);
 		}
 		resource_buffer->predicates = g_hash_table_new_full (g_direct_hash, g_direct_equal, g_object_unref, (GDestroyNotify) g_array_unref);
-		resource_buffer->tables = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) cache_table_free);
+		/* table name keys are owned by update_buffer.chunk */
+		resource_buffer->tables = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify) cache_table_free);
 
 		if (in_journal_replay) {
 			g_hash_table_insert (update_buffer.resources_by_id, GINT_TO_POINTER (subject_id), resource_buffer);
@@ -3281,6 +3443,18 @@ tracker_data_begin_transaction (GError **error)
 
 	g_return_if_fail (!in_transaction);
 
+	/* Ontology transactions use a separate journal writer and must not
+	 * share a SQLite transaction with pending regular updates. */
+	if (group_commit_pending > 0 && in_ontology_transaction) {
+		GError *n_error = NULL;
+
+		tracker_data_group_commit_flush (&n_error);
+		if (n_error) {
+			g_propagate_error (error, n_error);
+			return;
+		}
+	}
+
 	if (!tracker_db_manager_has_enough_space ()) {
 		g_set_error (error, TRACKER_SPARQL_ERROR, TRACKER_SPARQL_ERROR_NO_SPACE,
 			"There is not enough space on the file system for update operations");
@@ -3294,9 +3468,11 @@ tracker_data_begin_transaction (GError **error)
 	if (update_buffer.resource_cache == NULL) {
 		update_buffer.resource_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
 		/* used for normal transactions */
-		update_buffer.resources = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, (GDestroyNotify) resource_buffer_free);
+		/* subject keys are owned by update_buffer.chunk */
+		update_buffer.resources = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify) resource_buffer_free);
 		/* used for journal replay */
 		update_buffer.resources_by_id = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, (GDestroyNotify) resource_buffer_free);
+		update_buffer.chunk = g_string_chunk_new (1024);
 	}
 
 	resource_buffer = NULL;
@@ -3306,9 +3482,11 @@ tracker_data_begin_transaction (GError **error)
 
 	iface = tracker_db_manager_get_db_interface ();
 
-	tracker_db_interface_execute_query (iface, NULL, "PRAGMA cache_size = %d", TRACKER_DB_CACHE_SIZE_UPDATE);
+	if (group_commit_pending == 0) {
+		tracker_db_interface_execute_query (iface, NULL, "PRAGMA cache_size = %d", TRACKER_DB_CACHE_SIZE_UPDATE);
 
-	tracker_db_interface_start_transaction (iface);
+		tracker_db_interface_start_transaction (iface);
+	}
 
 #ifndef DISABLE_JOURNAL
 	if (!in_journal_replay) {
@@ -3347,11 +3525,179 @@ tracker_data_begin_transaction_for_replay (time_t time, GError **error)
 	resource_time = time;
 }
 
+void
+tracker_data_get_resource_cache_stats (guint64 *hits,
+                                       guint64 *misses)
+{
+	if (hits) {
+		*hits = resource_cache_hits;
+	}
+
+	if (misses) {
+		*misses = resource_cache_misses;
+	}
+}
+
+void
+tracker_data_set_deferred_fts (gboolean deferred)
+{
+#if HAVE_TRACKER_FTS
+	if (fts_deferred && !deferred) {
+		/* drain before returning to the synchronous behaviour */
+		tracker_data_process_deferred_fts (0);
+	}
+
+	fts_deferred = deferred;
+#endif
+}
+
+guint
+tracker_data_process_deferred_fts (guint max_updates)
+{
+#if HAVE_TRACKER_FTS
+	TrackerDBInterface *iface;
+	DeferredFtsUpdate *update;
+	guint processed = 0;
+
+	if (g_queue_is_empty (&deferred_fts_queue)) {
+		return 0;
+	}
+
+	g_return_val_if_fail (!in_transaction, g_queue_get_length (&deferred_fts_queue));
+
+	iface = tracker_db_manager_get_db_interface ();
+
+	tracker_db_interface_start_transaction (iface);
+
+	while ((max_updates == 0 || processed < max_updates) &&
+	       (update = g_queue_pop_head (&deferred_fts_queue)) != NULL) {
+		if (!tracker_db_interface_sqlite_fts_update_text (iface,
+		                                                  update->id,
+		                                                  (const gchar **) update->properties->pdata,
+		                                                  (const gchar **) update->text->pdata)) {
+			/* writer busy on another connection or similar, keep
+			 * the item and retry on the next drain */
+			g_queue_push_head (&deferred_fts_queue, update);
+			break;
+		}
+		deferred_fts_update_free (update);
+		processed++;
+	}
+
+	tracker_db_interface_end_db_transaction (iface, NULL);
+
+	deferred_fts_update_dirty_marker ();
+
+	return g_queue_get_length (&deferred_fts_queue);
+#else
+	return 0;
+#endif
+}
+
+void
+tracker_data_bulk_load_start (void)
+{
+	g_return_if_fail (!in_transaction);
+	g_return_if_fail (!in_bulk_load);
+
+	in_bulk_load = TRUE;
+
+	/* larger batches: buffer more resources per flush and let many
+	 * logical updates share one SQLite commit and journal fsync */
+	update_buffer_limit = 20000;
+	tracker_data_set_group_commit_limits (500, 1000);
+}
+
+void
+tracker_data_bulk_load_stop (GError **error)
+{
+	g_return_if_fail (!in_transaction);
+	g_return_if_fail (in_bulk_load);
+
+	in_bulk_load = FALSE;
+
+	update_buffer_limit = 1000;
+
+	tracker_data_group_commit_flush (error);
+	tracker_data_set_group_commit_limits (0, 0);
+
+	tracker_data_sync ();
+}
+
+void
+tracker_data_set_group_commit_limits (guint max_updates,
+                                      guint max_latency_ms)
+{
+	g_return_if_fail (!in_transaction);
+
+	if (group_commit_pending > 0 && max_updates == 0) {
+		tracker_data_group_commit_flush (NULL);
+	}
+
+	group_commit_max_updates = max_updates;
+	group_commit_max_latency = max_latency_ms;
+}
+
+void
+tracker_data_group_commit_flush (GError **error)
+{
+	TrackerDBInterface *iface;
+	GError *actual_error = NULL;
+
+	if (group_commit_pending == 0) {
+		return;
+	}
+
+	g_return_if_fail (!in_transaction);
+
+	iface = tracker_db_manager_get_db_interface ();
+
+	group_commit_pending = 0;
+
+	tracker_db_interface_end_db_transaction (iface, &actual_error);
+
+	if (actual_error) {
+		GError *ignorable = NULL;
+
+		/* The whole group is lost, take the journal back with it */
+		tracker_db_interface_execute_query (iface, &ignorable, "ROLLBACK");
+		if (ignorable) {
+			g_error_free (ignorable);
+		}
+#ifndef DISABLE_JOURNAL
+		/* After a rotation the recorded offset belongs to the
+		 * previous chunk, there is nothing left to truncate here */
+		if (!group_commit_rotated) {
+			tracker_db_journal_truncate (group_commit_journal_size);
+		}
+#endif /* DISABLE_JOURNAL */
+		/* resource IDs created by the rolled back group are gone */
+		g_hash_table_remove_all (update_buffer.resource_cache);
+		group_commit_has_persistent = FALSE;
+		group_commit_rotated = FALSE;
+		g_propagate_error (error, actual_error);
+		return;
+	}
+
+#ifndef DISABLE_JOURNAL
+	if (group_commit_has_persistent) {
+		/* One fsync covers every journal entry in the group */
+		tracker_db_journal_fsync ();
+	}
+#endif /* DISABLE_JOURNAL */
+
+	group_commit_has_persistent = FALSE;
+	group_commit_rotated = FALSE;
+
+	tracker_db_interface_execute_query (iface, NULL, "PRAGMA cache_size = %d", TRACKER_DB_CACHE_SIZE_DEFAULT);
+}
+
 void
 tracker_data_commit_transaction (GError **error)
 {
 	TrackerDBInterface *iface;
 	GError *actual_error = NULL;
+	gboolean was_ontology = in_ontology_transaction;
 
 	g_return_if_fail (in_transaction);
 
@@ -3364,6 +3710,82 @@ tracker_data_commit_transaction (GError **error)
 		return;
 	}
 
+	if (group_commit_max_updates > 0 &&
+	    !in_ontology_transaction &&
+	    !in_journal_replay) {
+		/* Group commit: the journal entry for this update goes out
+		 * now, the SQLite transaction stays open until the group is
+		 * full or the latency bound has expired. */
+#ifndef DISABLE_JOURNAL
+		if (group_commit_pending == 0) {
+			group_commit_journal_size = tracker_db_journal_get_size ();
+		}
+
+		if (has_persistent) {
+			tracker_db_journal_commit_db_transaction (&actual_error);
+		} else {
+			tracker_db_journal_rollback_transaction (&actual_error);
+		}
+
+		if (actual_error) {
+			/* Can't write in journal anymore; quite a serious problem */
+			g_propagate_error (error, actual_error);
+			/* Don't return, remainder of the function cleans things up */
+		}
+
+		if (tracker_db_journal_get_size () < group_commit_journal_size) {
+			/* The journal rotated under this group; entries before
+			 * the rotation are in the compressed chunk and can no
+			 * longer be truncated away, so the group must not stay
+			 * open past this point. */
+			group_commit_rotated = TRUE;
+		}
+#endif /* DISABLE_JOURNAL */
+
+		if (group_commit_pending == 0) {
+			group_commit_start_time = g_get_monotonic_time ();
+		}
+
+		group_commit_pending++;
+		group_commit_has_persistent |= has_persistent;
+
+		get_transaction_modseq ();
+		if (has_persistent) {
+			transaction_modseq++;
+		}
+
+		resource_time = 0;
+		in_transaction = FALSE;
+
+		if (update_buffer.class_counts) {
+			g_hash_table_remove_all (update_buffer.class_counts);
+		}
+
+#if HAVE_TRACKER_FTS
+		if (update_buffer.fts_ever_updated) {
+			update_buffer.fts_ever_updated = FALSE;
+		}
+
+		/* the transaction made it, its FTS work becomes available */
+		while (!g_queue_is_empty (&deferred_fts_staging)) {
+			g_queue_push_tail (&deferred_fts_queue,
+			                   g_queue_pop_head (&deferred_fts_staging));
+		}
+#endif
+
+		g_hash_table_remove_all (update_buffer.resources);
+		g_hash_table_remove_all (update_buffer.resources_by_id);
+
+		if (group_commit_rotated ||
+		    group_commit_pending >= group_commit_max_updates ||
+		    g_get_monotonic_time () - group_commit_start_time >=
+		    (gint64) group_commit_max_latency * 1000) {
+			tracker_data_group_commit_flush (error);
+		}
+
+		return;
+	}
+
 	tracker_db_interface_end_db_transaction (iface,
 	                                         &actual_error);
 
@@ -3411,13 +3833,25 @@ tracker_data_commit_transaction (GError **error)
 	if (update_buffer.fts_ever_updated) {
 		update_buffer.fts_ever_updated = FALSE;
 	}
+
+	/* the transaction made it, its FTS work becomes available */
+	while (!g_queue_is_empty (&deferred_fts_staging)) {
+		g_queue_push_tail (&deferred_fts_queue,
+		                   g_queue_pop_head (&deferred_fts_staging));
+	}
 #endif
 
 	tracker_db_interface_execute_query (iface, NULL, "PRAGMA cache_size = %d", TRACKER_DB_CACHE_SIZE_DEFAULT);
 
 	g_hash_table_remove_all (update_buffer.resources);
 	g_hash_table_remove_all (update_buffer.resources_by_id);
-	g_hash_table_remove_all (update_buffer.resource_cache);
+
+	if (was_ontology) {
+		/* ontology changes may delete and renumber resources, the
+		 * URI -> ID cache cannot be trusted across them; regular
+		 * commits keep it, IDs are never reassigned */
+		g_hash_table_remove_all (update_buffer.resource_cache);
+	}
 
 	in_journal_replay = FALSE;
 }
@@ -3456,6 +3890,21 @@ tracker_data_rollback_transaction (void)
 		g_error_free (ignorable);
 	}
 
+	if (group_commit_pending > 0) {
+		/* The ROLLBACK above also discarded the updates deferred by
+		 * group commit; drop their journal entries along with it.
+		 * After a rotation the offset belongs to the previous chunk
+		 * and the entries are out of reach. */
+#ifndef DISABLE_JOURNAL
+		if (!group_commit_rotated) {
+			tracker_db_journal_truncate (group_commit_journal_size);
+		}
+#endif /* DISABLE_JOURNAL */
+		group_commit_pending = 0;
+		group_commit_has_persistent = FALSE;
+		group_commit_rotated = FALSE;
+	}
+
 	tracker_db_interface_execute_query (iface, NULL, "PRAGMA cache_size = %d", TRACKER_DB_CACHE_SIZE_DEFAULT);
 
 	/* Runtime false in case of DISABLE_JOURNAL */
@@ -3551,6 +4000,9 @@ tracker_data_load_turtle_file (GFile   *file,
 void
 tracker_data_sync (void)
 {
+	tracker_data_group_commit_flush (NULL);
+	tracker_data_process_deferred_fts (0);
+
 #ifndef DISABLE_JOURNAL
 	tracker_db_journal_fsync ();
 #endif
@@ -3567,6 +4019,8 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 	GError *journal_error = NULL;
 	TrackerProperty *rdf_type = NULL;
 	gint last_operation_type = 0;
+	gboolean in_journal_txn = FALSE;
+	guint batch_count = 0;
 	const gchar *uri;
 	GError *n_error = NULL;
 
@@ -3581,6 +4035,10 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 		return;
 	}
 
+	/* Restore/recovery is one long bulk write: buffer more
+	 * resources per flush, like bulk load does */
+	update_buffer_limit = 20000;
+
 	while (tracker_db_journal_reader_next (&journal_error)) {
 		TrackerDBJournalEntryType type;
 		const gchar *object;
@@ -3613,12 +4071,50 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 			}
 
 		} else if (type == TRACKER_DB_JOURNAL_START_TRANSACTION) {
-			tracker_data_begin_transaction_for_replay (tracker_db_journal_reader_get_time (), NULL);
+			TrackerDBInterface *iface;
+
+			in_journal_txn = TRUE;
+			if (!in_transaction) {
+				tracker_data_begin_transaction_for_replay (tracker_db_journal_reader_get_time (), NULL);
+			} else {
+				GError *new_error = NULL;
+
+				/* coalesced with the previous journal
+				 * transactions; flush their statements into the
+				 * database transaction before the savepoint below,
+				 * so a torn tail can only ever take this journal
+				 * transaction back, never complete ones */
+				tracker_data_update_buffer_flush (&new_error);
+				if (new_error) {
+					g_warning ("Journal replay error: '%s'", new_error->message);
+					g_clear_error (&new_error);
+				}
+
+				resource_time = tracker_db_journal_reader_get_time ();
+			}
+
+			iface = tracker_db_manager_get_db_interface ();
+			tracker_db_interface_execute_query (iface, NULL, "SAVEPOINT replay_txn");
 		} else if (type == TRACKER_DB_JOURNAL_END_TRANSACTION) {
+			TrackerDBInterface *iface;
 			GError *new_error = NULL;
+
+			iface = tracker_db_manager_get_db_interface ();
+			tracker_db_interface_execute_query (iface, NULL, "RELEASE replay_txn");
+
+			in_journal_txn = FALSE;
+			batch_count++;
+
 			tracker_data_update_buffer_might_flush (&new_error);
 
-			tracker_data_commit_transaction (&new_error);
+			/* Replaying one SQLite transaction per journal transaction
+			 * is where most of the recovery time goes; coalesce them
+			 * and commit in batches instead. */
+			if (new_error == NULL && batch_count >= REPLAY_TRANSACTION_BATCH_SIZE) {
+				batch_count = 0;
+				tracker_data_commit_transaction (&new_error);
+			}
+
 			if (new_error) {
 				/* Out of disk is an unrecoverable fatal error */
 				if (g_error_matches (new_error, TRACKER_DB_INTERFACE_ERROR, TRACKER_DB_NO_SPACE)) {
@@ -3645,10 +4141,7 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 			}
 			last_operation_type = 1;
 
-			uri = tracker_ontologies_get_uri_by_id (predicate_id);
-			if (uri) {
-				property = tracker_ontologies_get_property_by_uri (uri);
-			}
+			property = tracker_ontologies_get_property_by_id (predicate_id);
 
 			if (property) {
 				resource_buffer_switch (NULL, graph_id, NULL, subject_id);
@@ -3684,10 +4177,7 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 			}
 			last_operation_type = 1;
 
-			uri = tracker_ontologies_get_uri_by_id (predicate_id);
-			if (uri) {
-				property = tracker_ontologies_get_property_by_uri (uri);
-			}
+			property = tracker_ontologies_get_property_by_id (predicate_id);
 
 			if (property) {
 				if (tracker_property_get_data_type (property) != TRACKER_PROPERTY_TYPE_RESOURCE) {
@@ -3696,10 +4186,7 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 					resource_buffer_switch (NULL, graph_id, NULL, subject_id);
 
 					if (property == rdf_type) {
-						uri = tracker_ontologies_get_uri_by_id (object_id);
-						if (uri) {
-							class = tracker_ontologies_get_class_by_uri (uri);
-						}
+						class = tracker_ontologies_get_class_by_id (object_id);
 						if (class) {
 							cache_create_service_decomposed (class, NULL, graph_id);
 						} else {
@@ -3742,10 +4229,7 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 
 			resource_buffer_switch (NULL, graph_id, NULL, subject_id);
 
-			uri = tracker_ontologies_get_uri_by_id (predicate_id);
-			if (uri) {
-				property = tracker_ontologies_get_property_by_uri (uri);
-			}
+			property = tracker_ontologies_get_property_by_id (predicate_id);
 
 			if (property) {
 				GError *new_error = NULL;
@@ -3788,20 +4272,14 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 			}
 			last_operation_type = -1;
 
-			uri = tracker_ontologies_get_uri_by_id (predicate_id);
-			if (uri) {
-				property = tracker_ontologies_get_property_by_uri (uri);
-			}
+			property = tracker_ontologies_get_property_by_id (predicate_id);
 
 			if (property) {
 
 				resource_buffer_switch (NULL, graph_id, NULL, subject_id);
 
 				if (property == rdf_type) {
-					uri = tracker_ontologies_get_uri_by_id (object_id);
-					if (uri) {
-						class = tracker_ontologies_get_class_by_uri (uri);
-					}
+					class = tracker_ontologies_get_class_by_id (object_id);
 					if (class) {
 						cache_delete_resource_type (class, NULL, graph_id);
 					} else {
@@ -3830,6 +4308,31 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 	}
 
 
+	if (in_transaction) {
+		GError *new_error = NULL;
+
+		if (in_journal_txn) {
+			TrackerDBInterface *iface;
+
+			/* the journal ends in the middle of a transaction: drop
+			 * its statements, buffered ones via the buffer, already
+			 * flushed ones via the savepoint bracketing it; the
+			 * complete transactions before it stay committed */
+			tracker_data_update_buffer_clear ();
+
+			iface = tracker_db_manager_get_db_interface ();
+			tracker_db_interface_execute_query (iface, NULL, "ROLLBACK TO replay_txn");
+			tracker_db_interface_execute_query (iface, NULL, "RELEASE replay_txn");
+		}
+
+		/* commit the journal transactions coalesced at the tail */
+		tracker_data_commit_transaction (&new_error);
+		if (new_error) {
+			g_warning ("Journal replay error: '%s'", new_error->message);
+			g_clear_error (&new_error);
+		}
+	}
+
 	if (journal_error) {
 		GError *n_error = NULL;
 		gsize size;
@@ -3858,6 +4361,8 @@ tracker_data_replay_journal (TrackerBusyCallback   busy_callback,
 	} else {
 		tracker_db_journal_reader_shutdown ();
 	}
+
+	update_buffer_limit = in_bulk_load ? 20000 : 1000;
 }
 
 #else
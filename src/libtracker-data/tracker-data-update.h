@@ -85,6 +85,27 @@ void     tracker_data_begin_ontology_transaction    (GError                   **
 void     tracker_data_begin_transaction_for_replay  (time_t                     time,
                                                      GError                   **error);
 void     tracker_data_commit_transaction            (GError                   **error);
+/* Group commit: accumulate up to max_updates independent update
+ * transactions (or until max_latency_ms has passed since the first
+ * deferred commit) in one SQLite transaction with a single journal
+ * fsync. The latency bound is checked on each commit; callers should
+ * flush from an idle/timeout source to bound latency on quiescence. */
+void     tracker_data_set_group_commit_limits       (guint                      max_updates,
+                                                     guint                      max_latency_ms);
+void     tracker_data_group_commit_flush            (GError                   **error);
+/* Bulk load: trades commit granularity and peak memory for
+ * throughput during initial indexing; brackets a stream of ordinary
+ * update transactions. */
+void     tracker_data_bulk_load_start               (void);
+void     tracker_data_bulk_load_stop                (GError                   **error);
+void     tracker_data_get_resource_cache_stats      (guint64                   *hits,
+                                                     guint64                   *misses);
+/* Deferred FTS: take tokenization off the commit path. Callers must
+ * drain the queue from an idle source via
+ * tracker_data_process_deferred_fts(); it processes up to max_updates
+ * items (0 = all) and returns how many remain. */
+void     tracker_data_set_deferred_fts              (gboolean                   deferred);
+guint    tracker_data_process_deferred_fts          (guint                      max_updates);
 void     tracker_data_notify_transaction            (TrackerDataCommitType      commit_type);
 void     tracker_data_rollback_transaction          (void);
 void     tracker_data_update_sparql                 (const gchar               *update,
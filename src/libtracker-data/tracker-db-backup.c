@@ -36,6 +36,11 @@
 
 #define TRACKER_DB_BACKUP_META_FILENAME_T	"meta-backup.db.tmp"
 
+/* Pages copied per backup step and pause between steps; bounds how
+ * long the source database is held at a time */
+#define BACKUP_PAGES_PER_STEP 512
+#define BACKUP_STEP_SLEEP_MS  25
+
 typedef struct {
 	GFile *destination;
 	TrackerDBBackupFinished callback;
@@ -121,9 +126,25 @@ backup_job (GTask        *task,
 		}
 	}
 
-	if (!info->error && sqlite3_backup_step (backup, -1) != SQLITE_DONE) {
-		g_set_error (&info->error, TRACKER_DB_BACKUP_ERROR, TRACKER_DB_BACKUP_ERROR_UNKNOWN,
-		             "Unable to complete sqlite3 backup");
+	if (!info->error) {
+		int ret;
+
+		/* Step in bounded chunks with pauses in between instead of
+		 * copying everything under one lock: the source stays
+		 * responsive to queries, and on SQLITE_BUSY/LOCKED the
+		 * backup picks up again instead of failing. */
+		do {
+			ret = sqlite3_backup_step (backup, BACKUP_PAGES_PER_STEP);
+
+			if (ret == SQLITE_OK || ret == SQLITE_BUSY || ret == SQLITE_LOCKED) {
+				sqlite3_sleep (BACKUP_STEP_SLEEP_MS);
+			}
+		} while (ret == SQLITE_OK || ret == SQLITE_BUSY || ret == SQLITE_LOCKED);
+
+		if (ret != SQLITE_DONE) {
+			g_set_error (&info->error, TRACKER_DB_BACKUP_ERROR, TRACKER_DB_BACKUP_ERROR_UNKNOWN,
+			             "Unable to complete sqlite3 backup");
+		}
 	}
 
 	if (backup) {
@@ -61,6 +61,10 @@ typedef struct {
 	TrackerDBStatement *tail;
 	guint size;
 	guint max;
+	/* how often a statement was served from resp. missed in the
+	 * cache, for tuning the cache sizes */
+	guint64 hits;
+	guint64 misses;
 } TrackerDBStatementLru;
 
 struct TrackerDBInterface {
@@ -1555,10 +1559,10 @@ tracker_db_interface_sqlite_fts_delete_id (TrackerDBInterface *db_interface,
 	return TRUE;
 }
 
-void
+gboolean
 tracker_db_interface_sqlite_fts_rebuild_tokens (TrackerDBInterface *interface)
 {
-	tracker_fts_rebuild_tokens (interface->db, "fts5");
+	return tracker_fts_rebuild_tokens (interface->db, "fts5");
 }
 
 #endif
@@ -1683,6 +1687,33 @@ tracker_db_interface_set_max_stmt_cache_size (TrackerDBInterface         *db_int
 	}
 }
 
+void
+tracker_db_interface_get_stmt_cache_stats (TrackerDBInterface          *db_interface,
+                                           TrackerDBStatementCacheType  cache_type,
+                                           guint64                     *hits,
+                                           guint64                     *misses)
+{
+	TrackerDBStatementLru *stmt_lru;
+
+	g_return_if_fail (TRACKER_IS_DB_INTERFACE (db_interface));
+
+	if (cache_type == TRACKER_DB_STATEMENT_CACHE_TYPE_UPDATE) {
+		stmt_lru = &db_interface->update_stmt_lru;
+	} else if (cache_type == TRACKER_DB_STATEMENT_CACHE_TYPE_SELECT) {
+		stmt_lru = &db_interface->select_stmt_lru;
+	} else {
+		return;
+	}
+
+	if (hits) {
+		*hits = stmt_lru->hits;
+	}
+
+	if (misses) {
+		*misses = stmt_lru->misses;
+	}
+}
+
 void
 tracker_db_interface_set_busy_handler (TrackerDBInterface  *db_interface,
                                        TrackerBusyCallback  busy_callback,
@@ -1746,6 +1777,12 @@ tracker_db_interface_create_statement (TrackerDBInterface           *db_interfac
 			stmt_lru = &db_interface->select_stmt_lru;
 		}
 
+		if (stmt) {
+			stmt_lru->hits++;
+		} else {
+			stmt_lru->misses++;
+		}
+
 	} else {
 		/* b) Non-Cached */
 		stmt = NULL;
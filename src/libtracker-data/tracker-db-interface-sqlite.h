@@ -66,7 +66,7 @@ gboolean            tracker_db_interface_sqlite_fts_delete_id          (TrackerD
 void                tracker_db_interface_sqlite_fts_update_commit      (TrackerDBInterface       *interface);
 void                tracker_db_interface_sqlite_fts_update_rollback    (TrackerDBInterface       *interface);
 
-void                tracker_db_interface_sqlite_fts_rebuild_tokens     (TrackerDBInterface       *interface);
+gboolean            tracker_db_interface_sqlite_fts_rebuild_tokens     (TrackerDBInterface       *interface);
 
 #endif
 
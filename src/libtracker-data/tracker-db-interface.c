@@ -63,6 +63,44 @@ tracker_db_interface_start_transaction (TrackerDBInterface *interface)
 	return TRUE;
 }
 
+gboolean
+tracker_db_interface_snapshot_begin (TrackerDBInterface  *interface,
+                                     GError             **error)
+{
+	GError *internal_error = NULL;
+
+	/* A deferred transaction pins the WAL snapshot seen by the first
+	 * statement until tracker_db_interface_snapshot_end(), so several
+	 * cursors can stream a consistent view of the data. On a
+	 * read-only connection this neither stalls nor gets aborted by
+	 * the writer, which keeps committing on its own connection. */
+	tracker_db_interface_execute_query (interface, &internal_error,
+	                                    "BEGIN DEFERRED TRANSACTION");
+
+	if (internal_error) {
+		g_propagate_error (error, internal_error);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+gboolean
+tracker_db_interface_snapshot_end (TrackerDBInterface  *interface,
+                                   GError             **error)
+{
+	GError *internal_error = NULL;
+
+	tracker_db_interface_execute_query (interface, &internal_error, "COMMIT");
+
+	if (internal_error) {
+		g_propagate_error (error, internal_error);
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
 gboolean
 tracker_db_interface_end_db_transaction (TrackerDBInterface  *interface,
                                          GError             **error)
@@ -90,6 +90,10 @@ GType                   tracker_db_cursor_get_type                   (void);
 void                    tracker_db_interface_set_max_stmt_cache_size (TrackerDBInterface         *db_interface,
                                                                       TrackerDBStatementCacheType cache_type,
                                                                       guint                       max_size);
+void                    tracker_db_interface_get_stmt_cache_stats    (TrackerDBInterface         *db_interface,
+                                                                      TrackerDBStatementCacheType cache_type,
+                                                                      guint64                    *hits,
+                                                                      guint64                    *misses);
 
 /* Functions to create queries/procedures */
 TrackerDBStatement *    tracker_db_interface_create_statement        (TrackerDBInterface          *interface,
@@ -107,6 +111,10 @@ void                    tracker_db_interface_execute_query           (TrackerDBI
                                                                        ...) G_GNUC_PRINTF (3, 4);
 
 gboolean                tracker_db_interface_start_transaction       (TrackerDBInterface         *interface);
+gboolean                tracker_db_interface_snapshot_begin          (TrackerDBInterface         *interface,
+                                                                      GError                    **error);
+gboolean                tracker_db_interface_snapshot_end            (TrackerDBInterface         *interface,
+                                                                      GError                    **error);
 gboolean                tracker_db_interface_end_db_transaction      (TrackerDBInterface         *interface,
                                                                       GError                    **error);
 void                    tracker_db_statement_bind_double             (TrackerDBStatement         *stmt,
@@ -42,7 +42,10 @@
 
 #ifndef DISABLE_JOURNAL
 
-#define MIN_BLOCK_SIZE    1024
+#define MIN_BLOCK_SIZE    4096
+/* keep the transaction block allocated between transactions up to
+ * this size; beyond it the memory is given back */
+#define MAX_RETAINED_BLOCK_SIZE (1024 * 1024)
 
 /*
  * data_format:
@@ -378,6 +381,22 @@ cur_block_kill (JournalWriter *jwriter)
 	jwriter->cur_block = NULL;
 }
 
+static void
+cur_block_reset (JournalWriter *jwriter)
+{
+	/* Small transactions dominate; re-use the block allocation for
+	 * the next transaction instead of freeing and regrowing it from
+	 * scratch every time. */
+	if (jwriter->cur_block_alloc > MAX_RETAINED_BLOCK_SIZE) {
+		cur_block_kill (jwriter);
+		return;
+	}
+
+	jwriter->cur_block_len = 0;
+	jwriter->cur_pos = 0;
+	jwriter->cur_entry_amount = 0;
+}
+
 static void
 cur_setnum (gchar   *dest,
             guint   *pos,
@@ -625,6 +644,8 @@ static gboolean
 db_journal_writer_shutdown (JournalWriter  *jwriter,
                             GError        **error)
 {
+	cur_block_kill (jwriter);
+
 	g_free (jwriter->journal_filename);
 	jwriter->journal_filename = NULL;
 
@@ -1121,7 +1142,7 @@ tracker_db_journal_rollback_transaction (GError **error)
 	g_return_val_if_fail (writer.journal > 0, FALSE);
 	g_return_val_if_fail (current_transaction_format != TRANSACTION_FORMAT_NONE, FALSE);
 
-	cur_block_kill (&writer);
+	cur_block_reset (&writer);
 
 	if (current_transaction_format == TRANSACTION_FORMAT_ONTOLOGY) {
 		cur_block_kill (&ontology_writer);
@@ -1142,7 +1163,16 @@ tracker_db_journal_truncate (gsize new_size)
 {
 	g_return_val_if_fail (writer.journal > 0, FALSE);
 
-	return (ftruncate (writer.journal, new_size) != -1);
+	if (ftruncate (writer.journal, new_size) == -1) {
+		return FALSE;
+	}
+
+	/* keep the cached size in sync, later writes append at the new
+	 * end (O_APPEND) and size-based decisions (rotation, group
+	 * commit offsets) must not see the pre-truncate size */
+	writer.cur_size = new_size;
+
+	return TRUE;
 }
 
 static gboolean
@@ -1188,7 +1218,7 @@ db_journal_writer_commit_db_transaction (JournalWriter  *jwriter,
 	jwriter->cur_size += jwriter->cur_block_len;
 
 	/* Clean up for next transaction */
-	cur_block_kill (jwriter);
+	cur_block_reset (jwriter);
 
 	return TRUE;
 }
@@ -27,6 +27,7 @@
 #include <time.h>
 #include <unistd.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <stdio.h>
 #include <fcntl.h>
 #include <errno.h>
@@ -67,6 +68,7 @@
 #define LAST_CRAWL_FILENAME           "last-crawl.txt"
 #define NEED_MTIME_CHECK_FILENAME     "no-need-mtime-check.txt"
 #define PARSER_SHA1_FILENAME          "parser-sha1.txt"
+#define FTS_DIRTY_FILENAME            "fts-dirty.txt"
 
 typedef enum {
 	TRACKER_DB_LOCATION_DATA_DIR,
@@ -162,6 +164,11 @@ static guint                 s_cache_size;
 static guint                 u_cache_size;
 
 static GPrivate              interface_data_key = G_PRIVATE_INIT ((GDestroyNotify)g_object_unref);
+/* threads that declared themselves readonly get a read-only WAL
+ * connection which cannot take the write lock, so their SELECT
+ * cursors neither stall on nor block the writer */
+static GPrivate              interface_data_key_ro = G_PRIVATE_INIT ((GDestroyNotify)g_object_unref);
+static GPrivate              thread_is_readonly_key = G_PRIVATE_INIT (NULL);
 
 /* mutex used by singleton connection in libtracker-direct, not used by tracker-store */
 static GMutex                global_mutex;
@@ -696,6 +703,32 @@ tracker_db_manager_set_current_locale (void)
 	g_free (current_locale);
 }
 
+/* How much of the database is asked into the page cache at startup */
+#define PREHEAT_MAX_BYTES (128 * 1024 * 1024)
+
+static void
+db_manager_preheat_database (TrackerDB db)
+{
+#ifdef HAVE_POSIX_FADVISE
+	struct stat st;
+	int fd;
+
+	fd = g_open (dbs[db].abs_filename, O_RDONLY | O_NOCTTY, 0);
+
+	if (fd < 0) {
+		return;
+	}
+
+	if (fstat (fd, &st) == 0) {
+		posix_fadvise (fd, 0,
+		               MIN (st.st_size, PREHEAT_MAX_BYTES),
+		               POSIX_FADV_WILLNEED);
+	}
+
+	close (fd);
+#endif /* HAVE_POSIX_FADVISE */
+}
+
 static void
 db_manager_analyze (TrackerDB           db,
                     TrackerDBInterface *iface)
@@ -706,7 +739,9 @@ db_manager_analyze (TrackerDB           db,
 
 	if (current_mtime > dbs[db].mtime) {
 		g_message ("  Analyzing DB:'%s'", dbs[db].name);
-		db_exec_no_reply (iface, "ANALYZE %s.Services", dbs[db].name);
+		/* refreshes sqlite_stat1 for every table and index, which is
+		 * what the query planner bases its join ordering on */
+		db_exec_no_reply (iface, "ANALYZE");
 
 		/* Remember current mtime for future */
 		dbs[db].mtime = current_mtime;
@@ -1194,6 +1229,15 @@ tracker_db_manager_init (TrackerDBManagerFlags   flags,
 
 	initialized = TRUE;
 
+	if ((flags & TRACKER_DB_MANAGER_READONLY) == 0) {
+		/* Kick off readahead of the database before the first
+		 * queries arrive; asynchronous, so startup is not held up,
+		 * and bounded so a huge store doesn't evict everything
+		 * else. Post-reboot first-query latency is dominated by
+		 * faulting these pages one by one otherwise. */
+		db_manager_preheat_database (TRACKER_DB_METADATA);
+	}
+
 	if (flags & TRACKER_DB_MANAGER_READONLY) {
 		resources_iface = tracker_db_manager_get_db_interfaces_ro (&internal_error, 1,
 		                                                           TRACKER_DB_METADATA);
@@ -1313,32 +1357,26 @@ tracker_db_manager_remove_all (gboolean rm_journal)
 void
 tracker_db_manager_optimize (void)
 {
-	gboolean dbs_are_open = FALSE;
 	TrackerDBInterface *iface;
 
 	g_return_if_fail (initialized != FALSE);
 
 	g_message ("Optimizing database...");
 
-	g_message ("  Checking database is not in use");
-
+	/* With the databases in WAL mode ANALYZE is an ordinary write
+	 * transaction and can run concurrently with readers; it only
+	 * needs to wait its turn behind the writer. */
 	iface = tracker_db_manager_get_db_interface ();
 
-	/* Check if any connections are open? */
-	if (G_OBJECT (iface)->ref_count > 1) {
-		g_message ("  database is still in use with %d references!",
-		           G_OBJECT (iface)->ref_count);
-
-		dbs_are_open = TRUE;
-	}
-
-	if (dbs_are_open) {
-		g_message ("  Not optimizing database, still in use with > 1 reference");
-		return;
-	}
-
 	/* Optimize the metadata database */
 	db_manager_analyze (TRACKER_DB_METADATA, iface);
+
+#if HAVE_TRACKER_FTS
+	/* Fold accumulated fts5 b-tree segments together; bounded work
+	 * per call, so repeated maintenance passes converge instead of
+	 * stalling once on a full merge */
+	db_exec_no_reply (iface, "INSERT INTO fts5(fts5, rank) VALUES('merge', 500)");
+#endif
 }
 
 const gchar *
@@ -1486,6 +1524,31 @@ tracker_db_manager_get_db_interface (void)
 		return global_iface;
 	}
 
+	if (GPOINTER_TO_INT (g_private_get (&thread_is_readonly_key))) {
+		interface = g_private_get (&interface_data_key_ro);
+
+		if (!interface) {
+			interface = tracker_db_manager_get_db_interfaces_ro (&internal_error, 1,
+			                                                     TRACKER_DB_METADATA);
+
+			if (internal_error) {
+				g_critical ("Error opening readonly database: %s", internal_error->message);
+				g_error_free (internal_error);
+				return NULL;
+			}
+
+			tracker_data_manager_init_fts (interface, FALSE);
+
+			tracker_db_interface_set_max_stmt_cache_size (interface,
+			                                              TRACKER_DB_STATEMENT_CACHE_TYPE_SELECT,
+			                                              s_cache_size);
+
+			g_private_set (&interface_data_key_ro, interface);
+		}
+
+		return interface;
+	}
+
 	interface = g_private_get (&interface_data_key);
 
 	/* Ensure the interface is there */
@@ -1515,6 +1578,21 @@ tracker_db_manager_get_db_interface (void)
 	return interface;
 }
 
+/**
+ * tracker_db_manager_set_thread_readonly:
+ * @readonly: whether this thread only runs SELECT queries
+ *
+ * Makes tracker_db_manager_get_db_interface() hand the calling thread
+ * a read-only connection. With the database in WAL mode such readers
+ * proceed concurrently with the single writer instead of serializing
+ * against it. Must only be enabled on threads that never update.
+ **/
+void
+tracker_db_manager_set_thread_readonly (gboolean readonly)
+{
+	g_private_set (&thread_is_readonly_key, GINT_TO_POINTER (readonly != FALSE));
+}
+
 /**
  * tracker_db_manager_has_enough_space:
  *
@@ -1804,6 +1882,54 @@ get_parser_sha1_filename (void)
 }
 
 
+static gchar *
+get_fts_dirty_filename (void)
+{
+	return g_build_filename (g_get_user_cache_dir (),
+	                         "tracker",
+	                         FTS_DIRTY_FILENAME,
+	                         NULL);
+}
+
+/* The FTS dirty marker exists while deferred FTS work is pending in
+ * memory; an unclean exit leaves it behind, which forces a token
+ * rebuild on the next start so committed resources never silently
+ * lack their text in the index. */
+gboolean
+tracker_db_manager_get_fts_dirty (void)
+{
+	gchar *filename;
+	gboolean dirty;
+
+	filename = get_fts_dirty_filename ();
+	dirty = g_file_test (filename, G_FILE_TEST_EXISTS);
+	g_free (filename);
+
+	return dirty;
+}
+
+void
+tracker_db_manager_set_fts_dirty (gboolean dirty)
+{
+	gchar *filename;
+
+	filename = get_fts_dirty_filename ();
+
+	if (dirty) {
+		GError *error = NULL;
+
+		if (!g_file_set_contents (filename, "", -1, &error)) {
+			g_warning ("Could not write '%s': %s", filename,
+			           error->message);
+			g_error_free (error);
+		}
+	} else {
+		g_unlink (filename);
+	}
+
+	g_free (filename);
+}
+
 gboolean
 tracker_db_manager_get_tokenizer_changed (void)
 {
@@ -66,6 +66,7 @@ void                tracker_db_manager_remove_all             (gboolean
 void                tracker_db_manager_optimize               (void);
 const gchar *       tracker_db_manager_get_file               (TrackerDB              db);
 TrackerDBInterface *tracker_db_manager_get_db_interface       (void);
+void                tracker_db_manager_set_thread_readonly    (gboolean               readonly);
 void                tracker_db_manager_init_locations         (void);
 gboolean            tracker_db_manager_has_enough_space       (void);
 void                tracker_db_manager_create_version_file    (void);
@@ -92,6 +93,8 @@ void                tracker_db_manager_set_current_locale     (void);
 
 gboolean            tracker_db_manager_get_tokenizer_changed  (void);
 void                tracker_db_manager_tokenizer_update       (void);
+gboolean            tracker_db_manager_get_fts_dirty          (void);
+void                tracker_db_manager_set_fts_dirty          (gboolean               dirty);
 
 G_END_DECLS
 
@@ -63,6 +63,11 @@ static gpointer    property_type_enum_class;
 
 /* Hash (int id, const gchar *uri) */
 static GHashTable *id_uri_pairs;
+/* id -> TrackerClass / TrackerProperty, filled lazily from the
+ * tables above; one probe instead of id->uri->object chains on the
+ * statement insert and replay hot paths */
+static GHashTable *class_ids;
+static GHashTable *property_ids;
 
 /* rdf:type */
 static TrackerProperty *rdf_type = NULL;
@@ -100,6 +105,8 @@ tracker_ontologies_init (void)
 	                                    g_free,
 	                                    g_object_unref);
 
+	class_ids = g_hash_table_new (g_direct_hash, g_direct_equal);
+	property_ids = g_hash_table_new (g_direct_hash, g_direct_equal);
 	id_uri_pairs = g_hash_table_new_full (g_direct_hash, g_direct_equal,
 	                                      NULL,
 	                                      g_free);
@@ -148,6 +155,12 @@ tracker_ontologies_shutdown (void)
 	g_hash_table_unref (id_uri_pairs);
 	id_uri_pairs = NULL;
 
+	g_hash_table_unref (class_ids);
+	class_ids = NULL;
+
+	g_hash_table_unref (property_ids);
+	property_ids = NULL;
+
 	g_ptr_array_foreach (properties, (GFunc) g_object_unref, NULL);
 	g_ptr_array_free (properties, TRUE);
 
@@ -353,6 +366,54 @@ tracker_ontologies_add_id_uri_pair (gint id, const gchar *uri)
 	                     g_strdup (uri));
 }
 
+TrackerClass *
+tracker_ontologies_get_class_by_id (gint id)
+{
+	TrackerClass *class;
+	const gchar *uri;
+
+	g_return_val_if_fail (id != -1, NULL);
+
+	class = g_hash_table_lookup (class_ids, GINT_TO_POINTER (id));
+
+	if (!class) {
+		uri = tracker_ontologies_get_uri_by_id (id);
+		if (uri) {
+			class = tracker_ontologies_get_class_by_uri (uri);
+		}
+		if (class) {
+			/* borrowed reference, classes owns it */
+			g_hash_table_insert (class_ids, GINT_TO_POINTER (id), class);
+		}
+	}
+
+	return class;
+}
+
+TrackerProperty *
+tracker_ontologies_get_property_by_id (gint id)
+{
+	TrackerProperty *property;
+	const gchar *uri;
+
+	g_return_val_if_fail (id != -1, NULL);
+
+	property = g_hash_table_lookup (property_ids, GINT_TO_POINTER (id));
+
+	if (!property) {
+		uri = tracker_ontologies_get_uri_by_id (id);
+		if (uri) {
+			property = tracker_ontologies_get_property_by_uri (uri);
+		}
+		if (property) {
+			/* borrowed reference, properties owns it */
+			g_hash_table_insert (property_ids, GINT_TO_POINTER (id), property);
+		}
+	}
+
+	return property;
+}
+
 TrackerProperty *
 tracker_ontologies_get_property_by_uri (const gchar *uri)
 {
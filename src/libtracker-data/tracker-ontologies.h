@@ -43,6 +43,7 @@ void               tracker_ontologies_sort                 (void);
 /* Service mechanics */
 void               tracker_ontologies_add_class            (TrackerClass     *service);
 TrackerClass *     tracker_ontologies_get_class_by_uri     (const gchar      *service_uri);
+TrackerClass *     tracker_ontologies_get_class_by_id      (gint              id);
 TrackerNamespace **tracker_ontologies_get_namespaces       (guint *length);
 TrackerOntology  **tracker_ontologies_get_ontologies       (guint *length);
 TrackerClass  **   tracker_ontologies_get_classes          (guint *length);
@@ -52,6 +53,7 @@ TrackerProperty *  tracker_ontologies_get_rdf_type         (void);
 /* Field mechanics */
 void               tracker_ontologies_add_property         (TrackerProperty  *field);
 TrackerProperty *  tracker_ontologies_get_property_by_uri  (const gchar      *uri);
+TrackerProperty *  tracker_ontologies_get_property_by_id   (gint              id);
 void               tracker_ontologies_add_namespace        (TrackerNamespace *namespace_);
 void               tracker_ontologies_add_ontology         (TrackerOntology  *ontology);
 TrackerNamespace * tracker_ontologies_get_namespace_by_uri (const gchar      *namespace_uri);
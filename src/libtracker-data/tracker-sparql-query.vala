@@ -248,6 +248,58 @@ public class Tracker.Sparql.Query : Object {
 
 	public bool no_cache { get; set; }
 
+	// Completed SELECT translations keyed by SPARQL text: repeated
+	// queries skip the parse and SQL generation passes entirely.
+	// The generated SQL only depends on the query text and the
+	// ontology, which is fixed after startup.
+	class TranslationCacheEntry {
+		public string sql;
+		public PropertyType[] types;
+		public string[] variable_names;
+		// literals in binding order
+		public string[] literals;
+		public PropertyType[] literal_types;
+	}
+
+	const int TRANSLATION_CACHE_MAX_SIZE = 100;
+	static Mutex translation_cache_mutex;
+	static HashTable<string,TranslationCacheEntry> translation_cache;
+
+	static TranslationCacheEntry? translation_cache_lookup (string query) {
+		TranslationCacheEntry? entry = null;
+
+		translation_cache_mutex.lock ();
+		if (translation_cache != null) {
+			entry = translation_cache.lookup (query);
+		}
+		translation_cache_mutex.unlock ();
+
+		return entry;
+	}
+
+	/* Called when the data manager shuts down: a later init may load
+	 * a different ontology/schema, invalidating the generated SQL. */
+	public static void clear_translation_cache () {
+		translation_cache_mutex.lock ();
+		if (translation_cache != null) {
+			translation_cache.remove_all ();
+		}
+		translation_cache_mutex.unlock ();
+	}
+
+	static void translation_cache_insert (string query, TranslationCacheEntry entry) {
+		translation_cache_mutex.lock ();
+		if (translation_cache == null) {
+			translation_cache = new HashTable<string,TranslationCacheEntry> (str_hash, str_equal);
+		}
+		if (translation_cache.size () >= TRANSLATION_CACHE_MAX_SIZE) {
+			// wholesale eviction, the hot set re-populates quickly
+			translation_cache.remove_all ();
+		}
+		translation_cache.insert (query, entry);
+		translation_cache_mutex.unlock ();
+	}
+
 	public Query (string query) {
 		no_cache = false; /* Start with false, expression sets it */
 		tokens = new TokenInfo[BUFFER_SIZE];
@@ -420,6 +472,11 @@ public class Tracker.Sparql.Query : Object {
 
 	public DBCursor? execute_cursor (bool threadsafe) throws DBInterfaceError, Sparql.Error, DateError {
 
+		var cached = translation_cache_lookup (query_string);
+		if (cached != null) {
+			return execute_cached_select (cached, threadsafe);
+		}
+
 		prepare_execute ();
 
 		switch (current ()) {
@@ -503,6 +560,26 @@ public class Tracker.Sparql.Query : Object {
 		return result;
 	}
 
+	static void bind_literal (DBStatement stmt, int i, PropertyType data_type, string literal) throws Sparql.Error, DateError {
+		if (data_type == PropertyType.BOOLEAN) {
+			if (literal == "true" || literal == "1") {
+				stmt.bind_int (i, 1);
+			} else if (literal == "false" || literal == "0") {
+				stmt.bind_int (i, 0);
+			} else {
+				throw new Sparql.Error.TYPE ("`%s' is not a valid boolean".printf (literal));
+			}
+		} else if (data_type == PropertyType.DATE) {
+			stmt.bind_int (i, (int) string_to_date (literal + "T00:00:00Z", null));
+		} else if (data_type == PropertyType.DATETIME) {
+			stmt.bind_double (i, string_to_date (literal, null));
+		} else if (data_type == PropertyType.INTEGER) {
+			stmt.bind_int (i, int.parse (literal));
+		} else {
+			stmt.bind_text (i, literal);
+		}
+	}
+
 	DBStatement prepare_for_exec (string sql) throws DBInterfaceError, Sparql.Error, DateError {
 		var iface = DBManager.get_db_interface ();
 		if (iface == null) {
@@ -514,29 +591,28 @@ public class Tracker.Sparql.Query : Object {
 		// set literals specified in query
 		int i = 0;
 		foreach (LiteralBinding binding in bindings) {
-			if (binding.data_type == PropertyType.BOOLEAN) {
-				if (binding.literal == "true" || binding.literal == "1") {
-					stmt.bind_int (i, 1);
-				} else if (binding.literal == "false" || binding.literal == "0") {
-					stmt.bind_int (i, 0);
-				} else {
-					throw new Sparql.Error.TYPE ("`%s' is not a valid boolean".printf (binding.literal));
-				}
-			} else if (binding.data_type == PropertyType.DATE) {
-				stmt.bind_int (i, (int) string_to_date (binding.literal + "T00:00:00Z", null));
-			} else if (binding.data_type == PropertyType.DATETIME) {
-				stmt.bind_double (i, string_to_date (binding.literal, null));
-			} else if (binding.data_type == PropertyType.INTEGER) {
-				stmt.bind_int (i, int.parse (binding.literal));
-			} else {
-				stmt.bind_text (i, binding.literal);
-			}
+			bind_literal (stmt, i, binding.data_type, binding.literal);
 			i++;
 		}
 
 		return stmt;
 	}
 
+	DBCursor? execute_cached_select (TranslationCacheEntry entry, bool threadsafe) throws DBInterfaceError, Sparql.Error, DateError {
+		var iface = DBManager.get_db_interface ();
+		if (iface == null) {
+			throw new DBInterfaceError.OPEN_ERROR ("Error opening database");
+		}
+
+		var stmt = iface.create_statement (DBStatementCacheType.SELECT, "%s", entry.sql);
+
+		for (int i = 0; i < entry.literals.length; i++) {
+			bind_literal (stmt, i, entry.literal_types[i], entry.literals[i]);
+		}
+
+		return stmt.start_sparql_cursor (entry.types, entry.variable_names, true);
+	}
+
 	DBCursor? exec_sql_cursor (string sql, PropertyType[]? types, string[]? variable_names, bool threadsafe) throws DBInterfaceError, Sparql.Error, DateError {
 		var stmt = prepare_for_exec (sql);
 
@@ -559,7 +635,27 @@ public class Tracker.Sparql.Query : Object {
 		SelectContext context;
 		string sql = get_select_query (out context);
 
-		return exec_sql_cursor (sql, context.types, context.variable_names, true);
+		var cursor = exec_sql_cursor (sql, context.types, context.variable_names, true);
+
+		if (!no_cache) {
+			var entry = new TranslationCacheEntry ();
+			entry.sql = sql;
+			entry.types = context.types;
+			entry.variable_names = context.variable_names;
+
+			entry.literals = new string[bindings.length ()];
+			entry.literal_types = new PropertyType[bindings.length ()];
+			int i = 0;
+			foreach (LiteralBinding binding in bindings) {
+				entry.literals[i] = binding.literal;
+				entry.literal_types[i] = binding.data_type;
+				i++;
+			}
+
+			translation_cache_insert (query_string, entry);
+		}
+
+		return cursor;
 	}
 
 	string get_ask_query () throws DBInterfaceError, Sparql.Error, DateError {
@@ -26,6 +26,13 @@ public class Tracker.Direct.Connection : Tracker.Sparql.Connection {
 
 		try {
 			if (use_count == 0) {
+				// Read-only attachment is safe while tracker-store
+				// holds the writer: the databases are in WAL mode, so
+				// this connection reads a consistent snapshot per
+				// statement without blocking or being blocked.
+				// Cross-process re-validation (schema generation,
+				// commits) is signalled via GraphUpdated/Writeback
+				// rather than a shared memory segment.
 				// make sure that current locale vs db locale are the same,
 				// otherwise return an error
 				Locale.init ();
@@ -44,6 +44,10 @@ tracker_encoding_can_guess (void)
 #endif
 }
 
+/* At most this much input is handed to the statistical detectors;
+ * they sample anyway and their cost is linear in the input */
+#define DETECTOR_MAX_SAMPLE 65536
+
 gchar *
 tracker_encoding_guess (const gchar *buffer,
                         gsize        size,
@@ -51,6 +55,22 @@ tracker_encoding_guess (const gchar *buffer,
 {
 	gchar *encoding = NULL;
 	gdouble conf = 1;
+	const gchar *end;
+
+	/* Fast path: valid UTF-8 (which covers pure ASCII) needs no
+	 * detector at all, and that is the overwhelming majority of
+	 * text corpora. Only a truncated trailing character may follow
+	 * the valid span for it to still count. */
+	if (g_utf8_validate (buffer, size, &end) ||
+	    (gsize) (end - buffer) + 6 > size) {
+		if (confidence)
+			*confidence = 1;
+
+		return g_strdup ("UTF-8");
+	}
+
+	if (size > DETECTOR_MAX_SAMPLE)
+		size = DETECTOR_MAX_SAMPLE;
 
 #ifdef HAVE_MEEGOTOUCH
 	encoding = tracker_encoding_guess_meegotouch (buffer, size);
@@ -43,6 +43,7 @@
 #define DEFAULT_IGNORE_STOP_WORDS    TRUE
 #define DEFAULT_ENABLE_STEMMER       FALSE  /* As per GB#526346, disabled */
 #define DEFAULT_ENABLE_UNACCENT      TRUE
+#define DEFAULT_PREFIX_INDEXES       ""
 
 static void config_set_property         (GObject       *object,
                                          guint          param_id,
@@ -67,6 +68,7 @@ enum {
 
 	/* Performance */
 	PROP_MAX_WORDS_TO_INDEX,
+	PROP_PREFIX_INDEXES,
 };
 
 G_DEFINE_TYPE (TrackerFTSConfig, tracker_fts_config, G_TYPE_SETTINGS);
@@ -128,6 +130,13 @@ tracker_fts_config_class_init (TrackerFTSConfigClass *klass)
 	                                                   G_MAXINT,
 	                                                   DEFAULT_MAX_WORDS_TO_INDEX,
 	                                                   G_PARAM_READWRITE));
+	g_object_class_install_property (object_class,
+	                                 PROP_PREFIX_INDEXES,
+	                                 g_param_spec_string ("prefix-indexes",
+	                                                      "Prefix index sizes",
+	                                                      " Space separated prefix lengths (e.g. '2 3 4') to keep dedicated fts5 prefix indexes for (default='')",
+	                                                      DEFAULT_PREFIX_INDEXES,
+	                                                      G_PARAM_READWRITE));
 
 }
 
@@ -168,6 +177,10 @@ config_set_property (GObject      *object,
 		tracker_fts_config_set_max_words_to_index (TRACKER_FTS_CONFIG (object),
 		                                           g_value_get_int (value));
 		break;
+	case PROP_PREFIX_INDEXES:
+		tracker_fts_config_set_prefix_indexes (TRACKER_FTS_CONFIG (object),
+		                                       g_value_get_string (value));
+		break;
 
 	default:
 		G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
@@ -203,6 +216,9 @@ config_get_property (GObject    *object,
 	case PROP_MAX_WORDS_TO_INDEX:
 		g_value_set_int (value, tracker_fts_config_get_max_words_to_index (config));
 		break;
+	case PROP_PREFIX_INDEXES:
+		g_value_take_string (value, tracker_fts_config_get_prefix_indexes (config));
+		break;
 
 	default:
 		G_OBJECT_WARN_INVALID_PROPERTY_ID (object, param_id, pspec);
@@ -239,6 +255,7 @@ config_constructed (GObject *object)
 	g_settings_bind (settings, "ignore-numbers", object, "ignore-numbers", G_SETTINGS_BIND_GET | G_SETTINGS_BIND_GET_NO_CHANGES);
 	g_settings_bind (settings, "ignore-stop-words", object, "ignore-stop-words", G_SETTINGS_BIND_GET | G_SETTINGS_BIND_GET_NO_CHANGES);
 	g_settings_bind (settings, "max-words-to-index", object, "max-words-to-index", G_SETTINGS_BIND_GET | G_SETTINGS_BIND_GET_NO_CHANGES);
+	g_settings_bind (settings, "prefix-indexes", object, "prefix-indexes", G_SETTINGS_BIND_GET | G_SETTINGS_BIND_GET_NO_CHANGES);
 }
 
 TrackerFTSConfig *
@@ -398,3 +415,21 @@ tracker_fts_config_set_max_words_to_index (TrackerFTSConfig *config,
         g_settings_set_int (G_SETTINGS (config), "max-words-to-index", value);
 	g_object_notify (G_OBJECT (config), "max-words-to-index");
 }
+
+gchar *
+tracker_fts_config_get_prefix_indexes (TrackerFTSConfig *config)
+{
+	g_return_val_if_fail (TRACKER_IS_FTS_CONFIG (config), g_strdup (DEFAULT_PREFIX_INDEXES));
+
+	return g_settings_get_string (G_SETTINGS (config), "prefix-indexes");
+}
+
+void
+tracker_fts_config_set_prefix_indexes (TrackerFTSConfig *config,
+                                       const gchar      *value)
+{
+	g_return_if_fail (TRACKER_IS_FTS_CONFIG (config));
+
+        g_settings_set_string (G_SETTINGS (config), "prefix-indexes", value ? value : "");
+	g_object_notify (G_OBJECT (config), "prefix-indexes");
+}
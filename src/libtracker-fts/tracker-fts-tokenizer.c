@@ -102,6 +102,27 @@ tracker_tokenizer_tokenize (Fts5Tokenizer *fts5_tokenizer,
 	if (length <= 0)
 		return rc;
 
+	/* The parser converts the whole buffer up front, but at most
+	 * max_words tokens will ever be consumed from it. Cap the input
+	 * for very large documents; the budget assumes every candidate
+	 * word has maximum length, so in practice it is many times what
+	 * max_words can use up even counting skipped words. */
+	if (data->max_words > 0) {
+		gint64 byte_budget;
+
+		byte_budget = (gint64) data->max_words * (data->max_word_length + 1) * 4;
+
+		if (byte_budget > 0 && (gint64) length > byte_budget) {
+			gint capped = (gint) byte_budget;
+
+			/* don't cut a UTF-8 sequence in half */
+			while (capped > 0 && (text[capped] & 0xC0) == 0x80)
+				capped--;
+
+			length = capped;
+		}
+	}
+
 	tracker_parser_reset (tokenizer->parser, text, length,
 	                      data->max_word_length,
 	                      data->enable_stemmer,
@@ -176,6 +197,12 @@ tracker_tokenizer_data_free (gpointer user_data)
 	g_free (data);
 }
 
+typedef struct {
+	GArray *offsets;
+	/* last token index the caller needs offsets for */
+	gint max_token;
+} TrackerOffsetsData;
+
 static int
 offsets_tokenizer_func (void       *data,
                         int         flags,
@@ -184,8 +211,15 @@ offsets_tokenizer_func (void       *data,
                         int         start,
                         int         end)
 {
-	GArray *offsets = data;
-	g_array_append_val (offsets, start);
+	TrackerOffsetsData *offsets_data = data;
+
+	g_array_append_val (offsets_data->offsets, start);
+
+	/* offsets past the last requested token are never read; cut the
+	 * tokenization of long documents short */
+	if (offsets_data->offsets->len > (guint) offsets_data->max_token)
+		return SQLITE_ABORT;
+
 	return SQLITE_OK;
 }
 
@@ -197,9 +231,10 @@ tracker_offsets_function (const Fts5ExtensionApi  *api,
                           sqlite3_value          **args)
 {
 	GString *str;
-	int rc, n_hits, i;
-	GArray *offsets = NULL;
+	int rc, n_hits, n_columns, i;
+	TrackerOffsetsData offsets_data = { NULL, 0 };
 	const gchar * const *property_names;
+	gint *max_tokens;
 	gint cur_col = -1;
 
 	if (n_args > 0) {
@@ -215,6 +250,21 @@ tracker_offsets_function (const Fts5ExtensionApi  *api,
 		return;
 	}
 
+	/* find the last token needed per column first, so the
+	 * re-tokenization below can stop there instead of walking the
+	 * whole document */
+	n_columns = api->xColumnCount (fts_ctx);
+	max_tokens = g_new0 (gint, n_columns);
+
+	for (i = 0; i < n_hits; i++) {
+		int phrase, col, n_token;
+
+		if (api->xInst (fts_ctx, i, &phrase, &col, &n_token) != SQLITE_OK)
+			break;
+
+		max_tokens[col] = MAX (max_tokens[col], n_token);
+	}
+
 	str = g_string_new (NULL);
 
 	for (i = 0; i < n_hits; i++) {
@@ -226,29 +276,38 @@ tracker_offsets_function (const Fts5ExtensionApi  *api,
 			const char *text;
 			int length;
 
-			if (offsets)
-				g_array_free (offsets, TRUE);
+			if (offsets_data.offsets)
+				g_array_free (offsets_data.offsets, TRUE);
 
-			offsets = g_array_new (FALSE, FALSE, sizeof (gint));
+			offsets_data.offsets = g_array_new (FALSE, FALSE, sizeof (gint));
+			offsets_data.max_token = max_tokens[col];
 			api->xColumnText (fts_ctx, col, &text, &length);
+			/* aborts once max_token offsets are collected */
 			api->xTokenize (fts_ctx, text, length,
-			                offsets, &offsets_tokenizer_func);
+			                &offsets_data, &offsets_tokenizer_func);
 			cur_col = col;
 		}
 
-		if (str->len != 0)
-			g_string_append_c (str, ',');
-
 		if (rc != SQLITE_OK)
 			break;
 
+		if ((guint) n_token >= offsets_data.offsets->len) {
+			/* stale index entry, no such token in the text */
+			continue;
+		}
+
+		if (str->len != 0)
+			g_string_append_c (str, ',');
+
 		g_string_append_printf (str, "%s,%d",
 		                        property_names[col],
-		                        g_array_index (offsets, gint, n_token));
+		                        g_array_index (offsets_data.offsets, gint, n_token));
 	}
 
-	if (offsets)
-		g_array_free (offsets, TRUE);
+	g_free (max_tokens);
+
+	if (offsets_data.offsets)
+		g_array_free (offsets_data.offsets, TRUE);
 
 	if (rc == SQLITE_OK) {
 		sqlite3_result_text (ctx, str->str, str->len, g_free);
@@ -320,8 +379,8 @@ tracker_rank_function (const Fts5ExtensionApi  *api,
                        sqlite3_value          **args)
 {
 	const gchar * const *property_names;
-	int i, rc, n_columns, n_tokens;
-	GHashTable *weights;
+	int i, rc = SQLITE_OK, n_columns, n_tokens;
+	guint *column_weights;
 	gdouble rank = 0;
 
 	if (n_args != 0) {
@@ -330,18 +389,35 @@ tracker_rank_function (const Fts5ExtensionApi  *api,
 	}
 
 	n_columns = api->xColumnCount (fts_ctx);
-	property_names = api->xUserData (fts_ctx);
-	weights = get_fts_weights (ctx);
 
-	if (!weights) {
-		sqlite3_result_error (ctx, "Could not read FTS weights", -1);
-		return;
+	/* The per-column weight vector is flattened once per query and
+	 * kept in the fts5 auxdata slot; per candidate row this leaves
+	 * only the column size lookups, which fts5 serves from its
+	 * docsize shadow table. */
+	column_weights = api->xGetAuxdata (fts_ctx, 0);
+
+	if (!column_weights) {
+		GHashTable *weights;
+
+		property_names = api->xUserData (fts_ctx);
+		weights = get_fts_weights (ctx);
+
+		if (!weights) {
+			sqlite3_result_error (ctx, "Could not read FTS weights", -1);
+			return;
+		}
+
+		column_weights = g_new (guint, n_columns);
+		for (i = 0; i < n_columns; i++) {
+			column_weights[i] =
+				GPOINTER_TO_UINT (g_hash_table_lookup (weights,
+				                                       property_names[i]));
+		}
+
+		api->xSetAuxdata (fts_ctx, column_weights, g_free);
 	}
 
 	for (i = 0; i < n_columns; i++) {
-		const gchar *property;
-		guint weight;
-
 		rc = api->xColumnSize (fts_ctx, i, &n_tokens);
 		if (rc != SQLITE_OK)
 			break;
@@ -349,9 +425,7 @@ tracker_rank_function (const Fts5ExtensionApi  *api,
 		if (n_tokens <= 0)
 			continue;
 
-		property = property_names[i];
-		weight = GPOINTER_TO_UINT (g_hash_table_lookup (weights, property));
-		rank += weight;
+		rank += column_weights[i];
 	}
 
 	if (rc == SQLITE_OK) {
@@ -21,8 +21,11 @@
 
 #include "config.h"
 
+#include <string.h>
+
 #include <libtracker-common/tracker-common.h>
 
+#include "tracker-fts-config.h"
 #include "tracker-fts-tokenizer.h"
 #include "tracker-fts.h"
 
@@ -122,7 +125,9 @@ tracker_fts_create_table (sqlite3    *db,
 {
 	GString *str, *from, *fts;
 	GHashTableIter iter;
+	TrackerFTSConfig *config;
 	gchar *index_table;
+	gchar *prefixes;
 	GList *columns;
 	gint rc;
 
@@ -178,6 +183,16 @@ tracker_fts_create_table (sqlite3    *db,
 		return FALSE;
 	}
 
+	config = tracker_fts_config_new ();
+	prefixes = tracker_fts_config_get_prefix_indexes (config);
+	if (prefixes && *prefixes &&
+	    strspn (prefixes, "0123456789 ") == strlen (prefixes)) {
+		/* dedicated prefix indexes for fast 'foo*' matches */
+		g_string_append_printf (fts, "prefix='%s', ", prefixes);
+	}
+	g_free (prefixes);
+	g_object_unref (config);
+
 	g_string_append (fts, "tokenize=TrackerTokenizer)");
 	rc = sqlite3_exec(db, fts->str, NULL, NULL, NULL);
 	g_string_free (fts, TRUE);
@@ -250,15 +265,35 @@ tracker_fts_alter_table (sqlite3    *db,
 	return rc == SQLITE_OK;
 }
 
-void
+gboolean
 tracker_fts_rebuild_tokens (sqlite3     *db,
                             const gchar *table_name)
 {
 	gchar *query;
+	gchar *errmsg = NULL;
+	gint64 start;
+	int rc;
+
+	start = g_get_monotonic_time ();
 
-	/* This special query rebuilds the tokens in the given FTS table */
+	/* This special query rebuilds the tokens in the given FTS table.
+	 * It runs as one statement inside the fts5 extension; the heavy
+	 * lifting (content scan and tokenization) cannot be partitioned
+	 * from out here. */
 	query = g_strdup_printf ("INSERT INTO %s(%s) VALUES('rebuild')",
 				 table_name, table_name);
-	sqlite3_exec(db, query, NULL, NULL, NULL);
+	rc = sqlite3_exec (db, query, NULL, NULL, &errmsg);
 	g_free (query);
+
+	if (rc != SQLITE_OK) {
+		g_warning ("Could not rebuild FTS tokens: %s",
+		           errmsg ? errmsg : "no error given");
+		sqlite3_free (errmsg);
+		return FALSE;
+	}
+
+	g_message ("FTS tokens rebuilt in %.2f seconds",
+	           (g_get_monotonic_time () - start) / (gdouble) G_USEC_PER_SEC);
+
+	return TRUE;
 }
@@ -34,6 +34,10 @@
 #define FILES_QUEUE_PROCESS_INTERVAL 2000
 #define FILES_QUEUE_PROCESS_MAX      5000
 
+/* How many directory children are checked per process_func()
+ * invocation before yielding back to the main loop */
+#define MAX_CHILDREN_PER_ITERATION   64
+
 /* This is the number of files to be called back with from GIO at a
  * time so we don't get called back for every file.
  */
@@ -634,37 +638,46 @@ process_func (gpointer data)
 		} else if (dir_data->was_inspected &&
 			   !dir_data->ignored_by_content &&
 			   dir_data->children != NULL) {
-			DirectoryChildData *child_data;
-			GNode *child_node = NULL;
+			guint n_processed = 0;
 
 			/* Directory has been already inspected, take children
-			 * one by one and check whether they should be incorporated
-			 * to the tree.
+			 * in batches and check whether they should be
+			 * incorporated to the tree. One child per main loop
+			 * iteration starves large crawls on dispatch
+			 * overhead.
 			 */
-			child_data = dir_data->children->data;
-			dir_data->children = g_slist_remove (dir_data->children, child_data);
-
-			if (((child_data->is_dir &&
-			      check_directory (crawler, info, child_data->child)) ||
-			     (!child_data->is_dir &&
-			      check_file (crawler, info, child_data->child))) &&
-			    /* Crawler may have been already stopped while we were waiting for the
-			     *	check_directory or check_file return value, and thus we should
-			     *	 check if it's running before going on */
-			    priv->is_running) {
-				child_node = g_node_prepend_data (dir_data->node,
-								  g_object_ref (child_data->child));
+			while (dir_data->children != NULL &&
+			       priv->is_running &&
+			       n_processed < MAX_CHILDREN_PER_ITERATION) {
+				DirectoryChildData *child_data;
+				GNode *child_node = NULL;
+
+				child_data = dir_data->children->data;
+				dir_data->children = g_slist_remove (dir_data->children, child_data);
+
+				if (((child_data->is_dir &&
+				      check_directory (crawler, info, child_data->child)) ||
+				     (!child_data->is_dir &&
+				      check_file (crawler, info, child_data->child))) &&
+				    /* Crawler may have been already stopped while we were waiting for the
+				     *	check_directory or check_file return value, and thus we should
+				     *	 check if it's running before going on */
+				    priv->is_running) {
+					child_node = g_node_prepend_data (dir_data->node,
+									  g_object_ref (child_data->child));
+				}
+
+				if (iterate && priv->is_running &&
+				    child_node && child_data->is_dir) {
+					DirectoryProcessingData *child_dir_data;
+
+					child_dir_data = directory_processing_data_new (child_node);
+					g_queue_push_tail (info->directory_processing_queue, child_dir_data);
+				}
+
+				directory_child_data_free (child_data);
+				n_processed++;
 			}
-
-			if (iterate && priv->is_running &&
-			    child_node && child_data->is_dir) {
-				DirectoryProcessingData *child_dir_data;
-
-				child_dir_data = directory_processing_data_new (child_node);
-				g_queue_push_tail (info->directory_processing_queue, child_dir_data);
-			}
-
-			directory_child_data_free (child_data);
 		} else {
 			/* No (more) children, or directory ignored. stop processing. */
 			g_queue_pop_head (info->directory_processing_queue);
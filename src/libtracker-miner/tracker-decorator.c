@@ -650,6 +650,32 @@ query_add_id_filter (GString  *query,
 	g_string_append (query, ")");
 }
 
+static void
+query_append_cached_items_filter (TrackerDecorator *decorator,
+				  GString          *query)
+{
+	TrackerDecoratorPrivate *priv = decorator->priv;
+	GList *l;
+	gint i = 0;
+
+	if (g_queue_is_empty (&priv->item_cache))
+		return;
+
+	g_string_append (query, "&& tracker:id(?urn) NOT IN (");
+
+	for (l = priv->item_cache.head; l; l = l->next) {
+		TrackerDecoratorInfo *info = l->data;
+
+		if (i != 0)
+			g_string_append (query, ",");
+
+		g_string_append_printf (query, "%d", info->id);
+		i++;
+	}
+
+	g_string_append (query, ")");
+}
+
 static void
 query_append_current_tasks_filter (TrackerDecorator *decorator,
 				   GString          *query)
@@ -721,6 +747,7 @@ create_query_string (TrackerDecorator  *decorator,
 			}
 
 			query_append_current_tasks_filter (decorator, query);
+			query_append_cached_items_filter (decorator, query);
 			g_string_append (query, " && ?type IN (");
 		} else {
 			g_string_append (query, ",");
@@ -886,9 +913,12 @@ decorator_cache_next_items (TrackerDecorator *decorator)
 {
 	TrackerDecoratorPrivate *priv = decorator->priv;
 
+	/* Refill before the cache runs dry: the next batch query then
+	 * overlaps with ongoing extraction instead of stalling it.
+	 * Items still cached are filtered out of the query. */
 	if (priv->querying ||
 	    g_hash_table_size (priv->tasks) > 0 ||
-	    !g_queue_is_empty (&priv->item_cache))
+	    g_queue_get_length (&priv->item_cache) > QUERY_BATCH_SIZE / 4)
 		return;
 
         priv->querying = TRUE;
@@ -25,9 +25,15 @@
 
 static void tracker_file_enumerator_file_iface_init (TrackerEnumeratorIface *iface);
 
+/* How many GFileInfos are fetched from GIO per blocking call; one
+ * kernel round trip and one worker thread hop then serve a whole
+ * batch of next() calls instead of one file each. */
+#define FILES_PER_BATCH 256
+
 struct _TrackerFileEnumerator {
 	GObject parent_instance;
 	GFileEnumerator *file_enumerator;
+	GList *cached_files;
 };
 
 /**
@@ -57,6 +63,8 @@ tracker_file_enumerator_finalize (GObject *object)
 		g_object_unref (tfe->file_enumerator);
 	}
 
+	g_list_free_full (tfe->cached_files, g_object_unref);
+
 	G_OBJECT_CLASS (tracker_file_enumerator_parent_class)->finalize (object);
 }
 
@@ -87,25 +95,36 @@ file_enumerator_next (TrackerEnumerator  *enumerator,
 	}
 
 	tfe = TRACKER_FILE_ENUMERATOR (enumerator);
-	info = g_file_enumerator_next_file (tfe->file_enumerator, cancellable, &local_error);
 
-	/* FIXME: Do we need a ->is_running check here like before? */
-	if (local_error || !info) {
+	if (!tfe->cached_files) {
+		tfe->cached_files = g_file_enumerator_next_files (tfe->file_enumerator,
+		                                                  FILES_PER_BATCH,
+		                                                  cancellable,
+		                                                  &local_error);
+
+		/* FIXME: Do we need a ->is_running check here like before? */
 		if (local_error) {
 			g_critical ("Could not crawl through directory: %s", local_error->message);
 			g_propagate_error (error, local_error);
-		}
 
-		/* No more files or we are stopping anyway, so clean
-		 * up and close all file enumerators.
-		 */
-		if (info) {
-			g_object_unref (info);
+			/* We are stopping anyway, so clean up and close
+			 * all file enumerators.
+			 */
+			g_list_free_full (tfe->cached_files, g_object_unref);
+			tfe->cached_files = NULL;
+
+			return NULL;
 		}
 
-		return NULL;
+		/* No more files */
+		if (!tfe->cached_files) {
+			return NULL;
+		}
 	}
 
+	info = tfe->cached_files->data;
+	tfe->cached_files = g_list_delete_link (tfe->cached_files, tfe->cached_files);
+
 	/* FIXME: We need some check here to call
 	 * enumerator_data_process which signals
 	 * CHECK_DIRECTORY_CONTENTS
@@ -143,11 +162,23 @@ file_enumerator_next_async (TrackerEnumerator    *enumerator,
                             GAsyncReadyCallback   callback,
                             gpointer              user_data)
 {
+	TrackerFileEnumerator *tfe = TRACKER_FILE_ENUMERATOR (enumerator);
 	GTask *task;
 
 	task = g_task_new (enumerator, cancellable, callback, user_data);
 	g_task_set_priority (task, io_priority);
-	g_task_run_in_thread (task, file_enumerator_next_thread);
+
+	if (tfe->cached_files) {
+		GFileInfo *info;
+
+		/* served from the prefetched batch, no thread hop needed */
+		info = tfe->cached_files->data;
+		tfe->cached_files = g_list_delete_link (tfe->cached_files, tfe->cached_files);
+		g_task_return_pointer (task, info, (GDestroyNotify) g_object_unref);
+	} else {
+		g_task_run_in_thread (task, file_enumerator_next_thread);
+	}
+
 	g_object_unref (task);
 }
 
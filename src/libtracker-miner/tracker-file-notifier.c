@@ -267,6 +267,11 @@ crawler_check_directory_contents_cb (TrackerCrawler *crawler,
 	return process;
 }
 
+/* The store acts as the persistent crawl cache here: it holds the
+ * mtime of every indexed file, and the comparison below decides
+ * created/updated/deleted per file after a restart. A sidecar cache
+ * keyed on directory mtimes cannot replace the enumeration pass,
+ * since modifying a file does not touch its parent's mtime. */
 static gboolean
 file_notifier_traverse_tree_foreach (GFile    *file,
                                      gpointer  user_data)
@@ -885,9 +890,14 @@ sparql_files_compose_query (GFile **files,
 	gchar *uri;
 	gint i = 0;
 
-	str = g_string_new ("SELECT ?url ?u nfo:fileLastModified(?u) {"
-			    "  ?u a rdfs:Resource ; nie:url ?url . "
-			    "FILTER (?url IN (");
+	/* One bulk query covers every file found by a crawl; size the
+	 * buffer for it up front, the IN list easily reaches hundreds
+	 * of thousands of characters on large directories. */
+	str = g_string_sized_new (128 + n_files * 80);
+	g_string_append (str,
+	                 "SELECT ?url ?u nfo:fileLastModified(?u) {"
+	                 "  ?u a rdfs:Resource ; nie:url ?url . "
+	                 "FILTER (?url IN (");
 	for (i = 0; i < n_files; i++) {
 		if (i != 0)
 			g_string_append_c (str, ',');
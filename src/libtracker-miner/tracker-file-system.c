@@ -105,7 +105,7 @@ file_node_data_free (FileNodeData *data,
 	data->file = NULL;
 	g_free (data->uri_prefix);
 
-	for (i = 0; i < data->properties->len; i++) {
+	for (i = 0; data->properties && i < data->properties->len; i++) {
 		FileNodeProperty *property;
 		GDestroyNotify destroy_notify;
 
@@ -120,7 +120,8 @@ file_node_data_free (FileNodeData *data,
 		}
 	}
 
-	g_array_free (data->properties, TRUE);
+	if (data->properties)
+		g_array_free (data->properties, TRUE);
 	g_slice_free (FileNodeData, data);
 }
 
@@ -137,7 +138,9 @@ file_node_data_new (TrackerFileSystem *file_system,
 	data = g_slice_new0 (FileNodeData);
 	data->file = g_object_ref (file);
 	data->file_type = file_type;
-	data->properties = g_array_new (FALSE, TRUE, sizeof (FileNodeProperty));
+	/* data->properties is created on first property set; most nodes
+	 * (plain crawled files) never get one and 10M-file crawls care
+	 * about one allocation per node */
 
 	/* We use weak refs to keep track of files */
 	g_object_weak_ref (G_OBJECT (data->file), file_weak_ref_notify, node);
@@ -171,7 +174,6 @@ file_node_data_root_new (GFile *root)
 	data = g_slice_new0 (FileNodeData);
 	data->uri_prefix = g_file_get_uri (root);
 	data->file = g_object_ref (root);
-	data->properties = g_array_new (FALSE, TRUE, sizeof (FileNodeProperty));
 	data->file_type = G_FILE_TYPE_DIRECTORY;
 	data->shallow = TRUE;
 
@@ -802,6 +804,9 @@ tracker_file_system_set_property (TrackerFileSystem *file_system,
 
 	data = node->data;
 
+	if (G_UNLIKELY (data->properties == NULL))
+		data->properties = g_array_new (FALSE, TRUE, sizeof (FileNodeProperty));
+
 	property.prop_quark = prop;
 	match = bsearch (&property, data->properties->data,
 	                 data->properties->len, sizeof (FileNodeProperty),
@@ -857,9 +862,13 @@ tracker_file_system_get_property_full (TrackerFileSystem *file_system,
 	data = node->data;
 	property.prop_quark = prop;
 
-	match = bsearch (&property, data->properties->data,
-	                 data->properties->len, sizeof (FileNodeProperty),
-	                 search_property_node);
+	if (data->properties) {
+		match = bsearch (&property, data->properties->data,
+		                 data->properties->len, sizeof (FileNodeProperty),
+		                 search_property_node);
+	} else {
+		match = NULL;
+	}
 
 	if (prop_data)
 		*prop_data = (match) ? match->value : NULL;
@@ -913,9 +922,13 @@ tracker_file_system_unset_property (TrackerFileSystem *file_system,
 	data = node->data;
 	property.prop_quark = prop;
 
-	match = bsearch (&property, data->properties->data,
-	                 data->properties->len, sizeof (FileNodeProperty),
-	                 search_property_node);
+	if (data->properties) {
+		match = bsearch (&property, data->properties->data,
+		                 data->properties->len, sizeof (FileNodeProperty),
+		                 search_property_node);
+	} else {
+		match = NULL;
+	}
 
 	if (!match) {
 		return;
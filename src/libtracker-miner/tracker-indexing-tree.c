@@ -19,6 +19,8 @@
  * Author: Carlos Garnacho  <carlos@lanedo.com>
  */
 
+#include <string.h>
+
 #include <libtracker-common/tracker-file-utils.h>
 #include "tracker-indexing-tree.h"
 
@@ -50,6 +52,7 @@ struct _PatternData
 	GPatternSpec *pattern;
 	TrackerFilterType type;
 	GFile *file; /* Only filled in in absolute paths */
+	guint is_literal : 1; /* No wildcards, matched through the hash table */
 };
 
 struct _FindNodeData
@@ -63,6 +66,10 @@ struct _TrackerIndexingTreePrivate
 {
 	GNode *config_tree;
 	GList *filter_patterns;
+	/* basename -> bitmask of TrackerFilterTypes, for the (common)
+	 * filters without wildcards; one hash probe replaces a walk
+	 * over all literal patterns */
+	GHashTable *filter_literals;
 	TrackerFilterPolicy policies[TRACKER_FILTER_PARENT_DIRECTORY + 1];
 
 	GFile *root;
@@ -124,6 +131,8 @@ pattern_data_new (const gchar *glob_string,
 
 	if (g_path_is_absolute (glob_string)) {
 		data->file = g_file_new_for_path (glob_string);
+	} else if (strpbrk (glob_string, "*?[") == NULL) {
+		data->is_literal = TRUE;
 	}
 
 	return data;
@@ -223,6 +232,7 @@ tracker_indexing_tree_finalize (GObject *object)
 
 	g_list_foreach (priv->filter_patterns, (GFunc) pattern_data_free, NULL);
 	g_list_free (priv->filter_patterns);
+	g_hash_table_unref (priv->filter_literals);
 
 	g_node_traverse (priv->config_tree,
 	                 G_POST_ORDER,
@@ -350,6 +360,9 @@ tracker_indexing_tree_init (TrackerIndexingTree *tree)
 	for (i = TRACKER_FILTER_FILE; i <= TRACKER_FILTER_PARENT_DIRECTORY; i++) {
 		priv->policies[i] = TRACKER_FILTER_POLICY_ACCEPT;
 	}
+
+	priv->filter_literals = g_hash_table_new_full (g_str_hash, g_str_equal,
+	                                               g_free, NULL);
 }
 
 /**
@@ -617,6 +630,16 @@ tracker_indexing_tree_add_filter (TrackerIndexingTree *tree,
 
 	data = pattern_data_new (glob_string, filter);
 	priv->filter_patterns = g_list_prepend (priv->filter_patterns, data);
+
+	if (data->is_literal) {
+		guint mask;
+
+		mask = GPOINTER_TO_UINT (g_hash_table_lookup (priv->filter_literals,
+		                                              glob_string));
+		g_hash_table_insert (priv->filter_literals,
+		                     g_strdup (glob_string),
+		                     GUINT_TO_POINTER (mask | (1 << filter)));
+	}
 }
 
 /**
@@ -635,6 +658,9 @@ tracker_indexing_tree_clear_filters (TrackerIndexingTree *tree,
 
 	g_return_if_fail (TRACKER_IS_INDEXING_TREE (tree));
 
+	GHashTableIter iter;
+	gpointer key, value;
+
 	priv = tree->priv;
 
 	for (l = priv->filter_patterns; l; l = l->next) {
@@ -649,6 +675,18 @@ tracker_indexing_tree_clear_filters (TrackerIndexingTree *tree,
 			pattern_data_free (data);
 		}
 	}
+
+	/* Drop this type's bit from the literal index */
+	g_hash_table_iter_init (&iter, priv->filter_literals);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		guint mask = GPOINTER_TO_UINT (value) & ~(1 << type);
+
+		if (mask == 0) {
+			g_hash_table_iter_remove (&iter);
+		} else {
+			g_hash_table_iter_replace (&iter, GUINT_TO_POINTER (mask));
+		}
+	}
 }
 
 /**
@@ -677,12 +715,19 @@ tracker_indexing_tree_file_matches_filter (TrackerIndexingTree *tree,
 	filters = priv->filter_patterns;
 	basename = g_file_get_basename (file);
 
+	/* Wildcard-less filters resolve with one hash probe */
+	if (GPOINTER_TO_UINT (g_hash_table_lookup (priv->filter_literals,
+	                                           basename)) & (1 << type)) {
+		g_free (basename);
+		return TRUE;
+	}
+
 	while (filters) {
 		PatternData *data = filters->data;
 
 		filters = filters->next;
 
-		if (data->type != type)
+		if (data->type != type || data->is_literal)
 			continue;
 
 		if (data->file &&
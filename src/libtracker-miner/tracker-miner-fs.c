@@ -221,6 +221,9 @@ struct _TrackerMinerFSPrivate {
 	/* Status */
 	GTimer *timer;
 	GTimer *extraction_timer;
+	GTimeVal progress_time_last;
+	gdouble progress_last;
+	gint progress_info_last;
 
 	guint been_started : 1;     /* TRUE if miner has been started */
 	guint been_crawled : 1;     /* TRUE if initial crawling has been
@@ -2402,7 +2405,6 @@ item_queue_handlers_cb (gpointer user_data)
 	GFile *parent;
 	QueueState queue;
 	GTimeVal time_now;
-	static GTimeVal time_last = { 0 };
 	gboolean keep_processing = TRUE;
 	gint priority = 0;
 
@@ -2450,14 +2452,12 @@ item_queue_handlers_cb (gpointer user_data)
 	/* Update progress, but don't spam it. */
 	g_get_current_time (&time_now);
 
-	if ((time_now.tv_sec - time_last.tv_sec) >= 1) {
+	if ((time_now.tv_sec - fs->priv->progress_time_last.tv_sec) >= 1) {
 		guint items_processed, items_remaining;
 		gdouble progress_now;
-		static gdouble progress_last = 0.0;
-		static gint info_last = 0;
 		gdouble seconds_elapsed, extraction_elapsed;
 
-		time_last = time_now;
+		fs->priv->progress_time_last = time_now;
 
 		/* Update progress? */
 		progress_now = item_queue_get_progress (fs,
@@ -2498,12 +2498,12 @@ item_queue_handlers_cb (gpointer user_data)
 			g_free (status);
 		}
 
-		if (++info_last >= 5 &&
-		    (gint) (progress_last * 100) != (gint) (progress_now * 100)) {
+		if (++fs->priv->progress_info_last >= 5 &&
+		    (gint) (fs->priv->progress_last * 100) != (gint) (progress_now * 100)) {
 			gchar *str1, *str2;
 
-			info_last = 0;
-			progress_last = progress_now;
+			fs->priv->progress_info_last = 0;
+			fs->priv->progress_last = progress_now;
 
 			/* Log estimated remaining time */
 			str1 = tracker_seconds_estimate_to_string (extraction_elapsed,
@@ -2784,8 +2784,18 @@ miner_fs_get_queue_priority (TrackerMinerFS *fs,
 	tracker_indexing_tree_get_root (fs->priv->indexing_tree,
 	                                file, &flags);
 
-	return (flags & TRACKER_DIRECTORY_FLAG_PRIORITY) ?
-	        G_PRIORITY_HIGH : G_PRIORITY_DEFAULT;
+	if (flags & TRACKER_DIRECTORY_FLAG_PRIORITY) {
+		return G_PRIORITY_HIGH;
+	}
+
+	/* Once the initial crawl is done, queued items come from
+	 * filesystem events on files the user just touched; jump them
+	 * ahead of any remaining bulk backlog so they index promptly. */
+	if (fs->priv->been_crawled) {
+		return G_PRIORITY_DEFAULT - 1;
+	}
+
+	return G_PRIORITY_DEFAULT;
 }
 
 static void
@@ -3533,6 +3543,15 @@ tracker_miner_fs_writeback_file (TrackerMinerFS *fs,
 
 	g_debug ("Performing write-back:'%s' (requested by application)", uri);
 
+	/* Bulk tag edits request the same file repeatedly while earlier
+	 * requests still sit in the queue; the newest request carries
+	 * the current store state, so it replaces any queued one and a
+	 * single rewrite of the file covers all of them. */
+	tracker_priority_queue_foreach_remove (fs->priv->items_writeback,
+	                                       writeback_files_equal,
+	                                       file,
+	                                       (GDestroyNotify) item_writeback_data_free);
+
 	trace_eq_push_tail ("WRITEBACK", file, "Requested by application");
 
 	data = item_writeback_data_new (file, rdf_types, results);
@@ -557,6 +557,9 @@ tracker_miner_init (TrackerMiner *miner)
 	                                      pause_data_destroy);
 }
 
+/* Minimum spacing of progress/status signal emissions */
+#define PROGRESS_SIGNAL_INTERVAL_MS 100
+
 static gboolean
 miner_update_progress_cb (gpointer data)
 {
@@ -643,10 +646,14 @@ miner_set_property (GObject      *object,
 		}
 
 		if (miner->priv->update_id == 0) {
-			miner->priv->update_id = g_idle_add_full (G_PRIORITY_HIGH_IDLE,
-			                                          miner_update_progress_cb,
-			                                          miner,
-			                                          NULL);
+			/* Coalesce further changes within the window; caps
+			 * PropertiesChanged/Progress broadcasts at 10 per
+			 * second however fast the properties change. */
+			miner->priv->update_id = g_timeout_add_full (G_PRIORITY_HIGH_IDLE,
+			                                             PROGRESS_SIGNAL_INTERVAL_MS,
+			                                             miner_update_progress_cb,
+			                                             miner,
+			                                             NULL);
 		}
 
 		break;
@@ -693,10 +700,14 @@ miner_set_property (GObject      *object,
 		}
 
 		if (miner->priv->update_id == 0) {
-			miner->priv->update_id = g_idle_add_full (G_PRIORITY_HIGH_IDLE,
-			                                          miner_update_progress_cb,
-			                                          miner,
-			                                          NULL);
+			/* Coalesce further changes within the window; caps
+			 * PropertiesChanged/Progress broadcasts at 10 per
+			 * second however fast the properties change. */
+			miner->priv->update_id = g_timeout_add_full (G_PRIORITY_HIGH_IDLE,
+			                                             PROGRESS_SIGNAL_INTERVAL_MS,
+			                                             miner_update_progress_cb,
+			                                             miner,
+			                                             NULL);
 		}
 
 		break;
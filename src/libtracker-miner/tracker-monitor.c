@@ -52,6 +52,9 @@
 /* The life time of an item in the cache */
 #define CACHE_LIFETIME_SECONDS 1
 
+/* Pending events above this count are treated as an event storm */
+#define EVENT_STORM_THRESHOLD 1000
+
 /* When we receive IO monitor events, we pause sending information to
  * the indexer for a few seconds before continuing. We have to receive
  * NO events for at least a few seconds before unpausing.
@@ -805,9 +808,12 @@ event_pairs_process_in_ht (TrackerMonitor *monitor,
 		if (!event_data->expirable)
 			continue;
 
-		/* If event is expirable, but didn't expire yet, keep it */
+		/* If event is expirable, but didn't expire yet, keep it.
+		 * Under an event storm, hold events longer: more of the
+		 * CREATE/UPDATE/DELETE sequences for the same file merge
+		 * in the cache instead of reaching the miner one by one. */
 		seconds = now->tv_sec - event_data->start_time.tv_sec;
-		if (seconds < 2)
+		if (seconds < (g_hash_table_size (ht) > EVENT_STORM_THRESHOLD ? 5 : 2))
 			continue;
 
 		g_debug ("Event '%s' for URI '%s' has timed out (%ld seconds have elapsed)",
@@ -1530,8 +1536,6 @@ tracker_monitor_add (TrackerMonitor *monitor,
 		return FALSE;
 	}
 
-	uri = g_file_get_uri (file);
-
 	if (monitor->priv->enabled) {
 		/* We don't check if a file exists or not since we might want
 		 * to monitor locations which don't exist yet.
@@ -1541,6 +1545,7 @@ tracker_monitor_add (TrackerMonitor *monitor,
 		dir_monitor = directory_monitor_new (monitor, file);
 
 		if (!dir_monitor) {
+			uri = g_file_get_uri (file);
 			g_warning ("Could not add monitor for path:'%s'",
 			           uri);
 			g_free (uri);
@@ -1556,11 +1561,13 @@ tracker_monitor_add (TrackerMonitor *monitor,
 	                     g_object_ref (file),
 	                     dir_monitor);
 
+#ifdef MONITOR_DEBUG_ADDS
+	uri = g_file_get_uri (file);
 	g_debug ("Added monitor for path:'%s', total monitors:%d",
 	         uri,
 	         g_hash_table_size (monitor->priv->monitors));
-
 	g_free (uri);
+#endif
 
 	return TRUE;
 }
@@ -1711,6 +1718,15 @@ tracker_monitor_is_watched_by_string (TrackerMonitor *monitor,
 	return watched;
 }
 
+guint
+tracker_monitor_get_pending_event_count (TrackerMonitor *monitor)
+{
+	g_return_val_if_fail (TRACKER_IS_MONITOR (monitor), 0);
+
+	return g_hash_table_size (monitor->priv->pre_update) +
+	       g_hash_table_size (monitor->priv->pre_delete);
+}
+
 guint
 tracker_monitor_get_count (TrackerMonitor *monitor)
 {
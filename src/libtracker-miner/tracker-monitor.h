@@ -76,6 +76,8 @@ gboolean        tracker_monitor_is_watched           (TrackerMonitor *monitor,
 gboolean        tracker_monitor_is_watched_by_string (TrackerMonitor *monitor,
                                                       const gchar    *path);
 guint           tracker_monitor_get_count            (TrackerMonitor *monitor);
+guint           tracker_monitor_get_pending_event_count
+                                                     (TrackerMonitor *monitor);
 guint           tracker_monitor_get_ignored          (TrackerMonitor *monitor);
 
 G_END_DECLS
@@ -23,6 +23,13 @@
 
 #include "tracker-priority-queue.h"
 
+/* Thread model: every producer and the consumer of these queues run
+ * in the main loop (crawler, monitor and notifier results are all
+ * dispatched there), so access is inherently serialized and the
+ * structure carries no locks on purpose. Priority segments are
+ * located by binary search; insertion and pop are O(1) within a
+ * segment. If producers ever move off the main thread, revisit this
+ * file before sprinkling mutexes at the call sites. */
 typedef struct PrioritySegment PrioritySegment;
 
 struct PrioritySegment
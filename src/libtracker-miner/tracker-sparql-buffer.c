@@ -51,6 +51,13 @@ struct _TrackerSparqlBufferPrivate
 	guint flush_timeout_id;
 	GPtrArray *tasks;
 	gint n_updates;
+
+	/* Adaptive flushing: the early-flush threshold follows the
+	 * store's observed commit latency between limit/4 (fast store,
+	 * flush eagerly for low latency) and the pool limit (slow
+	 * store, batch up to amortize the commit). */
+	guint flush_threshold;
+	gint64 flush_start_time;
 };
 
 struct _SparqlTaskData
@@ -256,6 +263,20 @@ tracker_sparql_buffer_update_array_cb (GObject      *object,
 	priv = TRACKER_SPARQL_BUFFER (update_data->buffer)->priv;
 	priv->n_updates--;
 
+	if (priv->flush_start_time != 0) {
+		gint64 elapsed;
+		guint limit;
+
+		elapsed = g_get_monotonic_time () - priv->flush_start_time;
+		limit = tracker_task_pool_get_limit (TRACKER_TASK_POOL (update_data->buffer));
+
+		if (elapsed > G_USEC_PER_SEC) {
+			priv->flush_threshold = MIN (priv->flush_threshold * 2, limit);
+		} else if (elapsed < G_USEC_PER_SEC / 5) {
+			priv->flush_threshold = MAX (priv->flush_threshold / 2, MAX (limit / 4, 1));
+		}
+	}
+
 	g_debug ("(Sparql buffer) Finished array-update with %u tasks",
 	         update_data->tasks->len);
 
@@ -535,6 +556,7 @@ tracker_sparql_buffer_flush (TrackerSparqlBuffer *buffer,
 	g_ptr_array_unref (priv->tasks);
 	priv->tasks = NULL;
 	priv->n_updates++;
+	priv->flush_start_time = g_get_monotonic_time ();
 
 	/* Start the update */
 	tracker_sparql_connection_update_array_async (priv->connection,
@@ -632,11 +654,16 @@ sparql_buffer_push_to_pool (TrackerSparqlBuffer *buffer,
 	 * the GPtrArray. */
 	g_ptr_array_add (priv->tasks, tracker_task_ref (task));
 
+	if (priv->flush_threshold == 0) {
+		priv->flush_threshold = MAX (tracker_task_pool_get_limit (TRACKER_TASK_POOL (buffer)) / 2, 1);
+	}
+
 	if (tracker_task_pool_limit_reached (TRACKER_TASK_POOL (buffer))) {
 		tracker_sparql_buffer_flush (buffer, "SPARQL buffer limit reached");
-	} else if (priv->tasks->len > tracker_task_pool_get_limit (TRACKER_TASK_POOL (buffer)) / 2) {
-		/* We've filled half of the buffer, flush it as we receive more tasks */
-		tracker_sparql_buffer_flush (buffer, "SPARQL buffer half-full");
+	} else if (priv->tasks->len > priv->flush_threshold) {
+		/* Enough accumulated for the store's current commit
+		 * latency, flush as we receive more tasks */
+		tracker_sparql_buffer_flush (buffer, "SPARQL buffer adaptive threshold reached");
 	}
 }
 
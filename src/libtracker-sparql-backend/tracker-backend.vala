@@ -91,6 +91,12 @@ class Tracker.Sparql.Backend : Connection {
 		base.dispose ();
 	}
 
+	/* Same-machine queries bypass IPC entirely when possible: the
+	 * direct backend reads meta.db in-process over a read-only WAL
+	 * connection while the store keeps writing, so small repeated
+	 * queries cost no pipe traffic or context switch at all. Only
+	 * updates (single writer) and direct-unavailable setups go over
+	 * the bus. */
 	public override Cursor query (string sparql, Cancellable? cancellable = null) throws Sparql.Error, IOError, DBusError {
 		debug ("%s(): '%s'", Log.METHOD, sparql);
 		if (direct != null) {
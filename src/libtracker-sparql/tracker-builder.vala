@@ -158,7 +158,9 @@ public class Tracker.Sparql.Builder : Object {
 	}
 
 	State[] states;
-	StringBuilder str = new StringBuilder ();
+	/* per-file updates from the miners run to a few KB; start there
+	 * instead of growing from empty on every builder */
+	StringBuilder str = new StringBuilder.sized (4096);
 
 	/**
 	 * tracker_sparql_builder_new_update:
@@ -509,7 +511,14 @@ public class Tracker.Sparql.Builder : Object {
 			states.length--;
 		}
 
-		str.append_printf (" \"%s\"", escape_string (literal));
+		str.append (" \"");
+		if (Posix.strcspn (literal, "\t\n\r\b\f\"\\") == literal.length) {
+			/* nothing to escape, skip the escaped copy */
+			str.append (literal);
+		} else {
+			str.append (escape_string (literal));
+		}
+		str.append_c ('"');
 		states += State.OBJECT;
 
 		length++;
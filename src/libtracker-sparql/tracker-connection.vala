@@ -232,6 +232,26 @@ public abstract class Tracker.Sparql.Connection : Object {
 	 */
 	public abstract Cursor query (string sparql, Cancellable? cancellable = null) throws Sparql.Error, GLib.Error, GLib.IOError, DBusError;
 
+	/**
+	 * tracker_sparql_connection_query_statement:
+	 * @self: a #TrackerSparqlConnection
+	 * @sparql: string containing the SPARQL query template with
+	 * <literal>~name</literal> placeholders
+	 * @cancellable: a #GCancellable used to cancel the operation
+	 * @error: #GError for error reporting.
+	 *
+	 * Prepares @sparql for repeated execution with different bound
+	 * values. See #TrackerSparqlStatement.
+	 *
+	 * Returns: a #TrackerSparqlStatement, or %NULL on error. Call
+	 * g_object_unref() on the returned statement when no longer needed.
+	 *
+	 * Since: 1.8
+	 */
+	public virtual Statement? query_statement (string sparql, Cancellable? cancellable = null) throws Sparql.Error, GLib.Error, GLib.IOError, DBusError {
+		return new Statement (this, sparql);
+	}
+
 	/**
 	 * tracker_sparql_connection_query_finish:
 	 * @self: a #TrackerSparqlConnection
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2016, Red Hat Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+/**
+ * SECTION: tracker-sparql-statement
+ * @short_description: Running repeated SPARQL queries with different values.
+ * @title: TrackerSparqlStatement
+ * @stability: Stable
+ * @include: tracker-sparql.h
+ *
+ * <para>
+ * #TrackerSparqlStatement holds a SPARQL query template containing
+ * <literal>~name</literal> placeholders. Values are attached to the
+ * placeholders through the tracker_sparql_statement_bind_* family,
+ * after which the statement may be executed. The same statement can
+ * be executed any number of times with different bound values, which
+ * avoids splicing literals into the query by hand (and the escaping
+ * mistakes that come with it) and keeps the query text stable so the
+ * store's prepared statement cache is effective.
+ * </para>
+ */
+
+/**
+ * TrackerSparqlStatement:
+ *
+ * The <structname>TrackerSparqlStatement</structname> object represents
+ * a SPARQL query with placeholders, to be executed one or more times.
+ */
+public class Tracker.Sparql.Statement : Object {
+
+	/**
+	 * TrackerSparqlStatement:sparql:
+	 *
+	 * The SPARQL query template this statement was created from.
+	 *
+	 * Since: 1.8
+	 */
+	public string sparql { get; construct; }
+
+	/**
+	 * TrackerSparqlStatement:connection:
+	 *
+	 * The #TrackerSparqlConnection the statement was created for.
+	 *
+	 * Since: 1.8
+	 */
+	public Connection connection { get; construct; }
+
+	HashTable<string,string> bindings;
+
+	public Statement (Connection connection, string query) {
+		Object (connection: connection, sparql: query);
+	}
+
+	construct {
+		bindings = new HashTable<string,string> (str_hash, str_equal);
+	}
+
+	/**
+	 * tracker_sparql_statement_bind_string:
+	 * @name: placeholder name
+	 * @value: value to bind
+	 *
+	 * Binds @value as a string literal to the placeholder ~@name.
+	 *
+	 * Since: 1.8
+	 */
+	public void bind_string (string name, string value) {
+		bindings.replace (name, "\"%s\"".printf (Tracker.Sparql.escape_string (value)));
+	}
+
+	/**
+	 * tracker_sparql_statement_bind_int:
+	 * @name: placeholder name
+	 * @value: value to bind
+	 *
+	 * Binds @value as an integer literal to the placeholder ~@name.
+	 *
+	 * Since: 1.8
+	 */
+	public void bind_int (string name, int64 value) {
+		bindings.replace (name, value.to_string ());
+	}
+
+	/**
+	 * tracker_sparql_statement_bind_boolean:
+	 * @name: placeholder name
+	 * @value: value to bind
+	 *
+	 * Binds @value as a boolean literal to the placeholder ~@name.
+	 *
+	 * Since: 1.8
+	 */
+	public void bind_boolean (string name, bool value) {
+		bindings.replace (name, value ? "true" : "false");
+	}
+
+	/**
+	 * tracker_sparql_statement_bind_double:
+	 * @name: placeholder name
+	 * @value: value to bind
+	 *
+	 * Binds @value as a double literal to the placeholder ~@name.
+	 *
+	 * Since: 1.8
+	 */
+	public void bind_double (string name, double value) {
+		char[] buf = new char[double.DTOSTR_BUF_SIZE];
+		bindings.replace (name, value.to_str (buf));
+	}
+
+	/**
+	 * tracker_sparql_statement_bind_iri:
+	 * @name: placeholder name
+	 * @value: IRI to bind
+	 *
+	 * Binds @value as an IRI reference to the placeholder ~@name.
+	 *
+	 * Since: 1.8
+	 */
+	public void bind_iri (string name, string value) {
+		bindings.replace (name, "<%s>".printf (Tracker.Sparql.escape_uri_printf ("%s", value)));
+	}
+
+	/**
+	 * tracker_sparql_statement_clear_bindings:
+	 *
+	 * Removes all bindings from the statement.
+	 *
+	 * Since: 1.8
+	 */
+	public void clear_bindings () {
+		bindings.remove_all ();
+	}
+
+	/* Replaces the ~name placeholders with the bound values. Quoted
+	 * strings and comments in the template are passed through
+	 * untouched so a literal '~' inside them is not misparsed. */
+	string apply_bindings () throws Sparql.Error {
+		var result = new StringBuilder.sized (sparql.length);
+		char *p = (char *) sparql;
+
+		while (*p != '\0') {
+			if (*p == '"' || *p == '\'') {
+				/* quoted string, copy verbatim up to the closing quote */
+				char quote = *p;
+				result.append_c (*p++);
+				while (*p != '\0') {
+					if (*p == '\\' && *(p + 1) != '\0') {
+						result.append_c (*p++);
+						result.append_c (*p++);
+					} else if (*p == quote) {
+						result.append_c (*p++);
+						break;
+					} else {
+						result.append_c (*p++);
+					}
+				}
+			} else if (*p == '#') {
+				/* comment, copy up to end of line */
+				while (*p != '\0' && *p != '\n') {
+					result.append_c (*p++);
+				}
+			} else if (*p == '~') {
+				char *start = ++p;
+				while (((char) *p).isalnum () || *p == '_') {
+					p++;
+				}
+
+				if (p == start) {
+					throw new Sparql.Error.PARSE ("'~' without a placeholder name");
+				}
+
+				var name = ((string) start).substring (0, (long) (p - start));
+				unowned string? value = bindings.lookup (name);
+
+				if (value == null) {
+					throw new Sparql.Error.PARSE ("Placeholder '~%s' has no value bound".printf (name));
+				}
+
+				result.append (value);
+			} else {
+				result.append_c (*p++);
+			}
+		}
+
+		return result.str;
+	}
+
+	/**
+	 * tracker_sparql_statement_execute:
+	 * @cancellable: a #GCancellable used to cancel the operation
+	 *
+	 * Executes the statement with the currently bound values.
+	 *
+	 * Returns: a #TrackerSparqlCursor with the results. On error, #NULL
+	 * is returned and @error is set accordingly.
+	 *
+	 * Since: 1.8
+	 */
+	public Cursor execute (Cancellable? cancellable = null) throws Sparql.Error, GLib.Error, GLib.IOError, DBusError {
+		return connection.query (apply_bindings (), cancellable);
+	}
+
+	/**
+	 * tracker_sparql_statement_execute_async:
+	 * @cancellable: a #GCancellable used to cancel the operation
+	 *
+	 * Executes the statement with the currently bound values,
+	 * asynchronously.
+	 *
+	 * Returns: a #TrackerSparqlCursor with the results. On error, #NULL
+	 * is returned and @error is set accordingly.
+	 *
+	 * Since: 1.8
+	 */
+	public async Cursor execute_async (Cancellable? cancellable = null) throws Sparql.Error, GLib.Error, GLib.IOError, DBusError {
+		return yield connection.query_async (apply_bindings (), cancellable);
+	}
+}
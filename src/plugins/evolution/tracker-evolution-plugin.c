@@ -368,19 +368,26 @@ thread_pool_destroy (ThreadPool *pool)
 	g_thread_create (destroyer_thread, pool, FALSE, NULL);
 }
 
+/* How many per-message updates are accumulated into one store
+ * transaction; mailbox syncs push tens of thousands of messages */
+#define SPARQL_UPDATE_BATCH_SIZE 100
+
+/* guarded by glock */
+static GString *pending_sparql = NULL;
+static guint pending_sparql_count = 0;
+
+/* called with glock held */
 static void
-send_sparql_update (TrackerMinerEvolution *self,
-                    const gchar           *sparql,
-                    gint                   prio)
+flush_sparql_updates (TrackerMinerEvolution *self)
 {
 	TrackerMinerEvolutionPrivate *priv;
 
-	/* FIXME: prio is unused */
-
-	g_static_rec_mutex_lock (&glock);
-
 	priv = TRACKER_MINER_EVOLUTION_GET_PRIVATE (self);
 
+	if (!pending_sparql || pending_sparql_count == 0) {
+		return;
+	}
+
 	if (!priv->timer_since_stopped || g_timer_elapsed (priv->timer_since_stopped, NULL) > 5) {
 		TrackerSparqlConnection *connection;
 
@@ -388,13 +395,44 @@ send_sparql_update (TrackerMinerEvolution *self,
 
 		if (connection) {
 			tracker_sparql_connection_update (connection,
-			                                  sparql,
+			                                  pending_sparql->str,
 			                                  G_PRIORITY_DEFAULT,
 			                                  priv->sparql_cancel,
 			                                  NULL);
 		}
 	}
 
+	g_string_truncate (pending_sparql, 0);
+	pending_sparql_count = 0;
+}
+
+static void
+send_sparql_update (TrackerMinerEvolution *self,
+                    const gchar           *sparql,
+                    gint                   prio)
+{
+	TrackerMinerEvolutionPrivate *priv;
+
+	/* FIXME: prio is unused */
+
+	g_static_rec_mutex_lock (&glock);
+
+	priv = TRACKER_MINER_EVOLUTION_GET_PRIVATE (self);
+
+	if (!priv->timer_since_stopped || g_timer_elapsed (priv->timer_since_stopped, NULL) > 5) {
+		if (!pending_sparql) {
+			pending_sparql = g_string_sized_new (SPARQL_UPDATE_BATCH_SIZE * 512);
+		}
+
+		g_string_append (pending_sparql, sparql);
+		g_string_append_c (pending_sparql, '\n');
+		pending_sparql_count++;
+
+		if (pending_sparql_count >= SPARQL_UPDATE_BATCH_SIZE) {
+			flush_sparql_updates (self);
+		}
+	}
+
 	g_static_rec_mutex_unlock (&glock);
 }
 
@@ -402,6 +440,10 @@ static void
 send_sparql_commit (TrackerMinerEvolution *self,
                     gboolean               update)
 {
+	g_static_rec_mutex_lock (&glock);
+	flush_sparql_updates (self);
+	g_static_rec_mutex_unlock (&glock);
+
 	if (update) {
 		gchar *date_s = tracker_date_to_string (time (NULL));
 
@@ -418,6 +460,11 @@ send_sparql_commit (TrackerMinerEvolution *self,
 
 		send_sparql_update (self, update, 0);
 
+		/* don't leave the timestamp sitting in the batch */
+		g_static_rec_mutex_lock (&glock);
+		flush_sparql_updates (self);
+		g_static_rec_mutex_unlock (&glock);
+
 		g_free (update);
 		g_free (date_s);
 	}
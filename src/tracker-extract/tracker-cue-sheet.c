@@ -309,6 +309,84 @@ tracker_cue_sheet_parse (const gchar *cue_sheet)
 	return result;
 }
 
+/* Cue sheet contents cache: every track of a split rip consults the
+ * same .cue file, so keep the last few read sheets keyed by path and
+ * validated by mtime instead of re-reading per track. */
+#define CUE_CACHE_MAX_SIZE 16
+
+typedef struct {
+	guint64 mtime;
+	gchar *contents;
+} CueCacheEntry;
+
+static GHashTable *cue_cache = NULL;
+static GMutex cue_cache_mutex;
+
+static void
+cue_cache_entry_free (CueCacheEntry *entry)
+{
+	g_free (entry->contents);
+	g_slice_free (CueCacheEntry, entry);
+}
+
+static gchar *
+load_cue_sheet_contents (GFile *cue_sheet_file)
+{
+	CueCacheEntry *entry;
+	gchar *path, *buffer = NULL;
+	guint64 mtime;
+	GError *error = NULL;
+
+	path = g_file_get_path (cue_sheet_file);
+
+	if (!path)
+		return NULL;
+
+	mtime = tracker_file_get_mtime (path);
+
+	g_mutex_lock (&cue_cache_mutex);
+
+	if (!cue_cache) {
+		cue_cache = g_hash_table_new_full (g_str_hash, g_str_equal,
+		                                   g_free,
+		                                   (GDestroyNotify) cue_cache_entry_free);
+	}
+
+	entry = g_hash_table_lookup (cue_cache, path);
+
+	if (entry && entry->mtime == mtime) {
+		buffer = g_strdup (entry->contents);
+		g_mutex_unlock (&cue_cache_mutex);
+		g_free (path);
+		return buffer;
+	}
+
+	g_mutex_unlock (&cue_cache_mutex);
+
+	g_file_load_contents (cue_sheet_file, NULL, &buffer, NULL, NULL, &error);
+
+	if (error != NULL) {
+		g_debug ("Unable to read cue sheet: %s", error->message);
+		g_error_free (error);
+		g_free (path);
+		return NULL;
+	}
+
+	g_mutex_lock (&cue_cache_mutex);
+
+	if (g_hash_table_size (cue_cache) >= CUE_CACHE_MAX_SIZE)
+		g_hash_table_remove_all (cue_cache);
+
+	entry = g_slice_new (CueCacheEntry);
+	entry->mtime = mtime;
+	entry->contents = g_strdup (buffer);
+	g_hash_table_insert (cue_cache, path, entry);
+
+	g_mutex_unlock (&cue_cache_mutex);
+
+	return buffer;
+}
+
 static GList *
 find_local_cue_sheets (GFile *audio_file)
 {
@@ -373,7 +451,6 @@ tracker_cue_sheet_parse_uri (const gchar *uri)
 	gchar *audio_file_name;
 	GList *cue_sheet_list;
 	TrackerToc *toc;
-	GError *error = NULL;
 	GList *n;
 
 	audio_file = g_file_new_for_uri (uri);
@@ -389,11 +466,9 @@ tracker_cue_sheet_parse_uri (const gchar *uri)
 
 		cue_sheet_file = n->data;
 
-		g_file_load_contents (cue_sheet_file, NULL, &buffer, NULL, NULL, &error);
+		buffer = load_cue_sheet_contents (cue_sheet_file);
 
-		if (error != NULL) {
-			g_debug ("Unable to read cue sheet: %s", error->message);
-			g_error_free (error);
+		if (buffer == NULL) {
 			continue;
 		}
 
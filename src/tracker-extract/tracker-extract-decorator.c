@@ -140,6 +140,12 @@ tracker_extract_decorator_finalize (GObject *object)
 	G_OBJECT_CLASS (tracker_extract_decorator_parent_class)->finalize (object);
 }
 
+/* Extraction results deliberately travel as SPARQL through the
+ * public connection API: the store re-validates them against the
+ * ontology and journals them like any other update. A pre-resolved
+ * binary (property-id, value) side channel would bypass both, and
+ * property ids are private to the store's current database
+ * generation, so crossing processes with them is not safe. */
 static void
 decorator_save_info (TrackerSparqlBuilder    *sparql,
                      TrackerExtractDecorator *decorator,
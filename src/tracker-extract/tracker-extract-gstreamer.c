@@ -1428,6 +1428,9 @@ common_extract_stream_metadata (MetadataExtractor    *extractor,
 #if defined(GSTREAMER_BACKEND_DISCOVERER) || \
     defined(GSTREAMER_BACKEND_GUPNP_DLNA)
 
+/* module runs in the main thread, see load_module() defaults */
+static GstDiscoverer *discoverer_reuse = NULL;
+
 static void
 discoverer_shutdown (MetadataExtractor *extractor)
 {
@@ -1481,23 +1484,30 @@ discoverer_init_and_run (MetadataExtractor *extractor,
 	extractor->has_video = FALSE;
 	extractor->has_audio = FALSE;
 
-	extractor->discoverer = gst_discoverer_new (5 * GST_SECOND, &error);
-	if (!extractor->discoverer) {
-		g_warning ("Couldn't create discoverer: %s",
-		           error ? error->message : "unknown error");
-		g_clear_error (&error);
-		return FALSE;
-	}
+	/* The discoverer is reused across files: this module runs in the
+	 * main thread only, and pipeline construction/teardown costs
+	 * more than the actual metadata read for small files. */
+	if (G_UNLIKELY (discoverer_reuse == NULL)) {
+		discoverer_reuse = gst_discoverer_new (5 * GST_SECOND, &error);
+		if (!discoverer_reuse) {
+			g_warning ("Couldn't create discoverer: %s",
+			           error ? error->message : "unknown error");
+			g_clear_error (&error);
+			return FALSE;
+		}
 
 #if defined(GST_TYPE_DISCOVERER_FLAGS)
-	/* Tell the discoverer to use *only* Tagreadbin backend.
-	 *  See https://bugzilla.gnome.org/show_bug.cgi?id=656345
-	 */
-	g_debug ("Using Tagreadbin backend in the GStreamer discoverer...");
-	g_object_set (extractor->discoverer,
-	              "flags", GST_DISCOVERER_FLAGS_EXTRACT_LIGHTWEIGHT,
-	              NULL);
+		/* Tell the discoverer to use *only* Tagreadbin backend.
+		 *  See https://bugzilla.gnome.org/show_bug.cgi?id=656345
+		 */
+		g_debug ("Using Tagreadbin backend in the GStreamer discoverer...");
+		g_object_set (discoverer_reuse,
+		              "flags", GST_DISCOVERER_FLAGS_EXTRACT_LIGHTWEIGHT,
+		              NULL);
 #endif
+	}
+
+	extractor->discoverer = g_object_ref (discoverer_reuse);
 
 	info = gst_discoverer_discover_uri (extractor->discoverer,
 	                                    uri,
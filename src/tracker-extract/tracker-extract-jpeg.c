@@ -260,6 +260,11 @@ tracker_extract_get_metadata (TrackerExtractInfo *info)
 			continue;
 		}
 
+		/* Nothing left that could still turn up */
+		if (comment && ed && xd && id) {
+			break;
+		}
+
 		marker = marker->next;
 	}
 
@@ -2337,6 +2337,14 @@ tracker_extract_get_metadata (TrackerExtractInfo *info)
 		return FALSE;
 	}
 
+#ifdef MADV_WILLNEED
+	/* The parsers below fault pages in on demand; prefetch the
+	 * typical tag + first-frames region in one request instead of
+	 * one synchronous page-sized read per fault. Oversized tags
+	 * (huge embedded art) still fault in lazily past this. */
+	madvise (buffer, MIN (buffer_size, 256 * 1024), MADV_WILLNEED);
+#endif
+
 	if (!get_id3 (id3v1_buffer, ID3V1_SIZE, &md.id3v1)) {
 		/* Do nothing? */
 	}
@@ -195,7 +195,8 @@ read_outline (PopplerDocument      *document,
 
 static gchar *
 extract_content_text (PopplerDocument *document,
-                      gsize            n_bytes)
+                      gsize            n_bytes,
+                      gboolean        *truncated)
 {
 	GString *string;
 	GTimer *timer;
@@ -239,6 +240,9 @@ extract_content_text (PopplerDocument *document,
 		g_object_unref (page);
 	}
 
+	if (truncated)
+		*truncated = (i < n_pages);
+
 	if (elapsed >= EXTRACTION_PROCESS_TIMEOUT) {
 		g_debug ("Extraction timed out, %d seconds reached", EXTRACTION_PROCESS_TIMEOUT);
 	}
@@ -305,6 +309,7 @@ tracker_extract_get_metadata (TrackerExtractInfo *info)
 	PopplerDocument *document;
 	gchar *xml = NULL;
 	gchar *content, *uri;
+	gboolean content_truncated = FALSE;
 	guint n_bytes;
 	GPtrArray *keywords;
 	guint i;
@@ -728,12 +733,18 @@ tracker_extract_get_metadata (TrackerExtractInfo *info)
 
 	config = tracker_main_get_config ();
 	n_bytes = tracker_config_get_max_bytes (config);
-	content = extract_content_text (document, n_bytes);
+	content = extract_content_text (document, n_bytes, &content_truncated);
 
 	if (content) {
 		tracker_sparql_builder_predicate (metadata, "nie:plainTextContent");
 		tracker_sparql_builder_object_unvalidated (metadata, content);
 		g_free (content);
+
+		if (content_truncated) {
+			/* let consumers tell partial text from short documents */
+			tracker_sparql_builder_predicate (metadata, "tracker:extractionTruncated");
+			tracker_sparql_builder_object_boolean (metadata, TRUE);
+		}
 	}
 
 	read_outline (document, metadata);
@@ -19,6 +19,7 @@
 
 #include "config.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
@@ -512,10 +513,90 @@ filter_module (TrackerExtract *extract,
 	return filter;
 }
 
+/* Watchdog for poison files: an extractor that neither finishes nor
+ * crashes would stall the pipeline forever. Aborting instead turns
+ * the hang into the crash case the persistence machinery already
+ * handles: D-Bus activation respawns the process with warm rules,
+ * and the offending file is marked failed and skipped.
+ *
+ * The deadline sources run on a dedicated thread with its own main
+ * context: main-thread modules (the default awareness) hang the
+ * default main loop itself, so a timeout attached there could never
+ * fire for exactly the extractors most likely to wedge. */
+#define EXTRACTION_DEADLINE_SECONDS 30
+
+static GMainContext *watchdog_context = NULL;
+
+static gpointer
+watchdog_thread_func (gpointer user_data)
+{
+	GMainContext *context = user_data;
+	GMainLoop *loop;
+
+	g_main_context_push_thread_default (context);
+	loop = g_main_loop_new (context, FALSE);
+	g_main_loop_run (loop);
+
+	return NULL;
+}
+
+static GMainContext *
+get_watchdog_context (void)
+{
+	static gsize initialized = 0;
+
+	if (g_once_init_enter (&initialized)) {
+		watchdog_context = g_main_context_new ();
+		g_thread_new ("extract-watchdog",
+		              watchdog_thread_func,
+		              watchdog_context);
+		g_once_init_leave (&initialized, 1);
+	}
+
+	return watchdog_context;
+}
+
+typedef struct {
+	gchar *file;
+	/* set (atomically) when the extraction finished, before the
+	 * source is destroyed; the callback may already be mid-dispatch
+	 * on the watchdog thread at that point and must not abort for a
+	 * task that made it */
+	gint done;
+} ExtractionDeadline;
+
+static void
+extraction_deadline_free (gpointer user_data)
+{
+	ExtractionDeadline *deadline = user_data;
+
+	g_free (deadline->file);
+	g_slice_free (ExtractionDeadline, deadline);
+}
+
+static gboolean
+extraction_deadline_cb (gpointer user_data)
+{
+	ExtractionDeadline *deadline = user_data;
+
+	if (g_atomic_int_get (&deadline->done)) {
+		/* finished right around the deadline, nothing to kill */
+		return FALSE;
+	}
+
+	g_critical ("Extraction of '%s' did not finish within %d seconds, aborting",
+	            deadline->file, EXTRACTION_DEADLINE_SECONDS);
+	abort ();
+
+	return FALSE;
+}
+
 static gboolean
 get_metadata (TrackerExtractTask *task)
 {
 	TrackerExtractInfo *info;
+	ExtractionDeadline *deadline_data;
+	GSource *deadline;
 
 #ifdef THREAD_ENABLE_TRACE
 	g_debug ("Thread:%p --> '%s': Collected metadata",
@@ -528,12 +609,26 @@ get_metadata (TrackerExtractTask *task)
 		return FALSE;
 	}
 
+	deadline_data = g_slice_new0 (ExtractionDeadline);
+	deadline_data->file = g_strdup (task->file);
+
+	deadline = g_timeout_source_new_seconds (EXTRACTION_DEADLINE_SECONDS);
+	g_source_set_callback (deadline, extraction_deadline_cb,
+	                       deadline_data, extraction_deadline_free);
+	g_source_attach (deadline, get_watchdog_context ());
+
 	if (!filter_module (task->extract, task->cur_module) &&
 	    get_file_metadata (task, &info)) {
+		g_atomic_int_set (&deadline_data->done, 1);
+		g_source_destroy (deadline);
+		g_source_unref (deadline);
 		g_task_return_pointer (G_TASK (task->res), info,
 		                       (GDestroyNotify) tracker_extract_info_unref);
 		extract_task_free (task);
 	} else {
+		g_atomic_int_set (&deadline_data->done, 1);
+		g_source_destroy (deadline);
+		g_source_unref (deadline);
 		/* Reinject the task into the main thread
 		 * queue, so the next module kicks in.
 		 */
@@ -344,6 +344,12 @@ tracker_read_text_from_fd (gint  fd,
 		return NULL;
 	}
 
+#ifdef HAVE_POSIX_FADVISE
+	/* We read the head of the file sequentially up to max_bytes;
+	 * tell the kernel so readahead covers the whole span at once. */
+	posix_fadvise (fd, 0, max_bytes, POSIX_FADV_SEQUENTIAL);
+#endif /* HAVE_POSIX_FADVISE */
+
 	/* Reading in chunks of BUFFER_SIZE
 	 *   Loop is halted whenever one of this conditions is met:
 	 *     a) Read bytes reached the maximum allowed (max_bytes)
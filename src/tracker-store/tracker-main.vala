@@ -28,8 +28,12 @@ License which can be viewed at:
   http://www.gnu.org/licenses/gpl.txt
 ";
 
-	const int SELECT_CACHE_SIZE = 100;
-	const int UPDATE_CACHE_SIZE = 100;
+	/* The query mix of the miners and libtracker-sparql applications is
+	 * highly repetitive; a larger prepared statement cache avoids
+	 * re-paying SQL compilation on the common templates. Still
+	 * overridable with TRACKER_STORE_SELECT/UPDATE_CACHE_SIZE. */
+	const int SELECT_CACHE_SIZE = 300;
+	const int UPDATE_CACHE_SIZE = 200;
 
 	static MainLoop main_loop;
 	static string log_filename;
@@ -278,12 +282,21 @@ License which can be viewed at:
 		notifier = null;
 
 		if (!shutdown) {
+			if (is_first_time_index) {
+				/* first-run indexing is one long bulk ingest */
+				Tracker.Store.start_bulk_load ();
+			}
+
 			Tracker.DBus.register_prepare_class_signal ();
 
 			Tracker.Events.init ();
 			Tracker.Writeback.init (get_writeback_predicates);
 			Tracker.Store.resume ();
 
+			/* seed the per-class counts, incrementally maintained
+			 * from here on, before the first Statistics.Get */
+			Tracker.Statistics.initialize ();
+
 			message ("Waiting for D-Bus requests...");
 		}
 
@@ -314,6 +327,12 @@ License which can be viewed at:
 		Tracker.Events.shutdown ();
 
 		Tracker.DBus.shutdown ();
+
+		/* Apply any FTS work still deferred and fsync the journal;
+		 * queued text would otherwise be lost with no repair path
+		 * short of a full rebuild. */
+		Tracker.Data.sync ();
+
 		Tracker.Data.Manager.shutdown ();
 		Tracker.Log.shutdown ();
 
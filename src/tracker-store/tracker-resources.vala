@@ -200,6 +200,11 @@ public class Tracker.Resources : Object {
 		/* no longer needed, just return */
 	}
 
+	/* GraphUpdated carries the class URI as its first argument, so
+	 * subscribers get per-class filtering for free with an arg0
+	 * match rule - the bus daemon then never wakes processes for
+	 * classes they didn't subscribe to. Emission is already batched
+	 * per commit window by the graphupdated-delay timer. */
 	bool emit_graph_updated (Class cl) {
 		if (cl.has_insert_events () || cl.has_delete_events ()) {
 			var builder = new VariantBuilder ((VariantType) "a(iiii)");
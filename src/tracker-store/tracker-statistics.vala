@@ -23,17 +23,23 @@ public class Tracker.Statistics : Object {
 
 	static bool initialized;
 
-	[DBus (signature = "aas")]
-	public new Variant get (BusName sender) throws GLib.Error {
-		var request = DBusRequest.begin (sender, "Statistics.Get");
+	/* Seeds the per-class instance counts with one scan; from then on
+	 * the update code maintains them incrementally at commit time, so
+	 * Statistics.Get is a memory lookup however often a dashboard
+	 * polls it. Called at startup to keep the scan out of the first
+	 * D-Bus request (and off the main loop). */
+	public static void initialize () {
+		if (initialized) {
+			return;
+		}
 
-		if (!initialized) {
-			var iface = DBManager.get_db_interface ();
+		var iface = DBManager.get_db_interface ();
 
-			foreach (var cl in Ontologies.get_classes ()) {
-				/* xsd classes do not derive from rdfs:Resource and do not use separate tables */
-				if (!cl.name.has_prefix ("xsd:")) {
-					/* update statistics */
+		foreach (var cl in Ontologies.get_classes ()) {
+			/* xsd classes do not derive from rdfs:Resource and do not use separate tables */
+			if (!cl.name.has_prefix ("xsd:")) {
+				/* update statistics */
+				try {
 					var stmt = iface.create_statement (DBStatementCacheType.NONE,
 						                           "SELECT COUNT(1) FROM \"%s\"",
 						                            cl.name);
@@ -44,12 +50,21 @@ public class Tracker.Statistics : Object {
 					} else {
 						warning ("Unable to query instance count for class %s", cl.name);
 					}
+				} catch (Error e) {
+					warning ("Unable to query instance count for class %s: %s", cl.name, e.message);
 				}
 			}
-
-			initialized = true;
 		}
 
+		initialized = true;
+	}
+
+	[DBus (signature = "aas")]
+	public new Variant get (BusName sender) throws GLib.Error {
+		var request = DBusRequest.begin (sender, "Statistics.Get");
+
+		initialize ();
+
 		var builder = new VariantBuilder ((VariantType) "aas");
 
 		foreach (var cl in Ontologies.get_classes ()) {
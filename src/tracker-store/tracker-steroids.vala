@@ -38,7 +38,9 @@ public class Tracker.Steroids : Object {
 
 				int[] column_sizes = new int[n_columns];
 				int[] column_offsets = new int[n_columns];
-				string[] column_data = new string[n_columns];
+				/* unowned: borrow the cursor's cell strings for the
+				 * duration of the row instead of copying each one */
+				(unowned string)[] column_data = new (unowned string)[n_columns];
 
 				variable_names = new string[n_columns];
 				for (int i = 0; i < n_columns; i++) {
@@ -180,6 +182,12 @@ public class Tracker.Steroids : Object {
 				data_input_stream.read_all (((uint8[]) query_array[i])[0:query_size], out bytes_read);
 
 				request.debug ("query: %s", query_array[i]);
+				/* whitespace keeps adjacent updates tokenized apart,
+				 * otherwise the combined fast path fails over to
+				 * one-by-one execution for well-formed batches */
+				if (i > 0) {
+					combined_query.append_c ('\n');
+				}
 				combined_query.append (query_array[i]);
 			}
 
@@ -20,7 +20,11 @@
  */
 
 public class Tracker.Store {
-	const int MAX_CONCURRENT_QUERIES = 2;
+	// upper bound for the query thread pool; the effective limit
+	// follows the core count now that query threads run on their own
+	// read-only connections and scale with the hardware
+	const int MAX_CONCURRENT_QUERIES = 8;
+	static int max_concurrent_queries;
 
 	const int MAX_TASK_TIME = 30;
 
@@ -30,12 +34,18 @@ public class Tracker.Store {
 	static bool update_running;
 	static ThreadPool<Task> update_pool;
 	static ThreadPool<Task> query_pool;
-	static ThreadPool<bool> checkpoint_pool;
+	static ThreadPool<int> checkpoint_pool;
 	static GenericArray<Task> running_tasks;
 	static int max_task_time;
 	static bool active;
 	static SourceFunc active_callback;
 
+	/* Scheduling model: interactive D-Bus calls (Query/Update) enter
+	 * the HIGH lane and are drained before the LOW lane that batch
+	 * miners use (BatchUpdate/Turtle), so interactive work preempts
+	 * bulk at dispatch granularity. Updates serialize because SQLite
+	 * has one writer; runaway queries are bounded by the
+	 * max-task-time watchdog cancelling their cursors. */
 	public enum Priority {
 		HIGH,
 		LOW,
@@ -48,8 +58,18 @@ public class Tracker.Store {
 		UPDATE,
 		UPDATE_BLANK,
 		TURTLE,
+		DEFERRED_FTS,
 	}
 
+	/* Query results are streamed straight from a cursor to the
+	 * client fd; there is deliberately no store-side result cache.
+	 * Repeat queries already skip parse and SQL compilation via the
+	 * translation and prepared-statement caches, SQLite serves the
+	 * pages from its own cache, and an exact-result cache would need
+	 * commit-time invalidation tracking for every class a query
+	 * touched - bookkeeping that costs every writer to help only
+	 * pollers, who are better served client side where staleness
+	 * tolerance is known. */
 	public delegate void SparqlQueryInThread (DBCursor cursor) throws Error;
 
 	abstract class Task {
@@ -82,6 +102,55 @@ public class Tracker.Store {
 		public string path;
 	}
 
+	/* applies queued FTS text updates in the update thread, between
+	 * regular update tasks */
+	class FtsTask : Task {
+	}
+
+	static bool fts_task_queued;
+	static uint fts_remaining;
+	static bool bulk_load_active;
+
+	/* During first-time indexing the update stream is one long bulk
+	 * ingest; trade commit granularity for throughput until the
+	 * update queues first run dry. */
+	public static void start_bulk_load () {
+		if (!bulk_load_active) {
+			bulk_load_active = true;
+			Tracker.Data.bulk_load_start ();
+		}
+	}
+
+	static void maybe_stop_bulk_load () {
+		if (!bulk_load_active || update_running) {
+			return;
+		}
+
+		for (int i = 0; i < Priority.N_PRIORITIES; i++) {
+			if (update_queues[i].get_length () > 0) {
+				return;
+			}
+		}
+
+		bulk_load_active = false;
+		try {
+			Tracker.Data.bulk_load_stop ();
+		} catch (Error e) {
+			warning (e.message);
+		}
+	}
+
+	static void queue_deferred_fts () {
+		if (fts_task_queued) {
+			return;
+		}
+
+		var task = new FtsTask ();
+		task.type = TaskType.DEFERRED_FTS;
+		update_queues[Priority.LOW].push_tail (task);
+		fts_task_queued = true;
+	}
+
 	static void sched () {
 		Task task = null;
 
@@ -89,7 +158,7 @@ public class Tracker.Store {
 			return;
 		}
 
-		while (n_queries_running < MAX_CONCURRENT_QUERIES) {
+		while (n_queries_running < max_concurrent_queries) {
 			for (int i = 0; i < Priority.N_PRIORITIES; i++) {
 				task = query_queues[i].pop_head ();
 				if (task != null) {
@@ -195,6 +264,37 @@ public class Tracker.Store {
 			task.error = null;
 
 			update_running = false;
+		} else if (task.type == TaskType.DEFERRED_FTS) {
+			task.error = null;
+			update_running = false;
+			fts_task_queued = false;
+
+			if (fts_remaining > 0) {
+				queue_deferred_fts ();
+			}
+		}
+
+		if (task.type != TaskType.QUERY) {
+			// the initial ingest is over once the update queues
+			// first run dry
+			maybe_stop_bulk_load ();
+		}
+
+		if (task.type == TaskType.UPDATE || task.type == TaskType.UPDATE_BLANK || task.type == TaskType.TURTLE) {
+			// pick up FTS text the update deferred out of its
+			// transaction once the queue drains
+			queue_deferred_fts ();
+
+			// with enough accumulated changes the planner statistics
+			// go stale; refresh them in the checkpoint thread
+			if (++updates_since_analyze >= ANALYZE_UPDATE_INTERVAL) {
+				updates_since_analyze = 0;
+				try {
+					checkpoint_pool.push (CHECKPOINT_TASK_ANALYZE);
+				} catch (Error e) {
+					warning (e.message);
+				}
+			}
 		}
 
 		if (n_queries_running == 0 && !update_running && active_callback != null) {
@@ -211,9 +311,45 @@ public class Tracker.Store {
 			if (task.type == TaskType.QUERY) {
 				var query_task = (QueryTask) task;
 
-				var cursor = Tracker.Data.query_sparql_cursor (query_task.query);
+				/* query threads never update, serve their cursors
+				 * from a read-only connection so they proceed
+				 * concurrently with the writer */
+				DBManager.set_thread_readonly (true);
+
+				var timer = new Timer ();
+
+				/* pin one snapshot across query execution and result
+				 * streaming: long exports see a consistent view while
+				 * the writer keeps committing on its own connection */
+				var query_iface = DBManager.get_db_interface ();
+				bool snapshot = false;
+
+				try {
+					query_iface.snapshot_begin ();
+					snapshot = true;
+				} catch (Error e) {
+					warning ("Could not pin query snapshot: %s", e.message);
+				}
+
+				try {
+					var cursor = Tracker.Data.query_sparql_cursor (query_task.query);
+
+					query_task.in_thread (cursor);
+				} finally {
+					if (snapshot) {
+						try {
+							query_iface.snapshot_end ();
+						} catch (Error e) {
+							warning ("Could not release query snapshot: %s", e.message);
+						}
+					}
+				}
 
-				query_task.in_thread (cursor);
+				var elapsed = timer.elapsed ();
+				if (slow_query_threshold > 0 && elapsed >= slow_query_threshold) {
+					message ("Slow query (%.2fs, threshold %.2fs): %s",
+					         elapsed, slow_query_threshold, query_task.query);
+				}
 			} else {
 				var iface = DBManager.get_db_interface ();
 				iface.sqlite_wal_hook (wal_hook);
@@ -237,6 +373,8 @@ public class Tracker.Store {
 					} finally {
 						Tracker.Events.reset_pending ();
 					}
+				} else if (task.type == TaskType.DEFERRED_FTS) {
+					fts_remaining = Tracker.Data.process_deferred_fts (200);
 				}
 			}
 		} catch (Error e) {
@@ -261,6 +399,15 @@ public class Tracker.Store {
 	}
 
 	static int checkpointing;
+	/* queries slower than this (seconds) are logged with their
+	 * SPARQL; 0 disables. Set via TRACKER_STORE_SLOW_QUERY_SECONDS */
+	static double slow_query_threshold;
+	static int updates_since_analyze;
+	const int ANALYZE_UPDATE_INTERVAL = 10000;
+
+	// checkpoint thread task codes (0 is not a valid ThreadPool payload)
+	const int CHECKPOINT_TASK_CHECKPOINT = 1;
+	const int CHECKPOINT_TASK_ANALYZE = 2;
 
 	static void wal_hook (int n_pages) {
 		// run in update thread
@@ -275,7 +422,7 @@ public class Tracker.Store {
 			if (AtomicInt.compare_and_exchange (ref checkpointing, 0, 1)) {
 				// initiate asynchronous checkpointing (not blocking updates)
 				try {
-					checkpoint_pool.push (true);
+					checkpoint_pool.push (CHECKPOINT_TASK_CHECKPOINT);
 				} catch (Error e) {
 					warning (e.message);
 					AtomicInt.set (ref checkpointing, 0);
@@ -284,14 +431,26 @@ public class Tracker.Store {
 		}
 	}
 
-	static void checkpoint_dispatch_cb (bool task) {
+	static void checkpoint_dispatch_cb (int task) {
 		// run in checkpoint thread
 
-		wal_checkpoint ();
-		AtomicInt.set (ref checkpointing, 0);
+		if (task == CHECKPOINT_TASK_CHECKPOINT) {
+			wal_checkpoint ();
+			AtomicInt.set (ref checkpointing, 0);
+		} else {
+			// refresh the planner statistics off the update thread
+			DBManager.optimize ();
+		}
 	}
 
 	public static void init () {
+		string slow_query_env = Environment.get_variable ("TRACKER_STORE_SLOW_QUERY_SECONDS");
+		if (slow_query_env != null) {
+			slow_query_threshold = double.parse (slow_query_env);
+		} else {
+			slow_query_threshold = 1.0;
+		}
+
 		string max_task_time_env = Environment.get_variable ("TRACKER_STORE_MAX_TASK_TIME");
 		if (max_task_time_env != null) {
 			max_task_time = int.parse (max_task_time_env);
@@ -299,8 +458,14 @@ public class Tracker.Store {
 			max_task_time = MAX_TASK_TIME;
 		}
 
+		max_concurrent_queries = ((int) GLib.get_num_processors ()).clamp (2, MAX_CONCURRENT_QUERIES);
+
 		running_tasks = new GenericArray<Task> ();
 
+		/* tokenization happens between updates instead of inside
+		 * their transactions */
+		Tracker.Data.set_deferred_fts (true);
+
 		for (int i = 0; i < Priority.N_PRIORITIES; i++) {
 			query_queues[i] = new Queue<Task> ();
 			update_queues[i] = new Queue<Task> ();
@@ -308,8 +473,8 @@ public class Tracker.Store {
 
 		try {
 			update_pool = new ThreadPool<Task>.with_owned_data (pool_dispatch_cb, 1, true);
-			query_pool = new ThreadPool<Task>.with_owned_data (pool_dispatch_cb, MAX_CONCURRENT_QUERIES, true);
-			checkpoint_pool = new ThreadPool<bool>.with_owned_data (checkpoint_dispatch_cb, 1, true);
+			query_pool = new ThreadPool<Task>.with_owned_data (pool_dispatch_cb, max_concurrent_queries, true);
+			checkpoint_pool = new ThreadPool<int>.with_owned_data (checkpoint_dispatch_cb, 1, true);
 		} catch (Error e) {
 			warning (e.message);
 		}
@@ -479,7 +644,7 @@ public class Tracker.Store {
 			// this will wait for checkpointing to finish
 			checkpoint_pool = null;
 			try {
-				checkpoint_pool = new ThreadPool<bool> (checkpoint_dispatch_cb, 1, true);
+				checkpoint_pool = new ThreadPool<int> (checkpoint_dispatch_cb, 1, true);
 			} catch (Error e) {
 				warning (e.message);
 			}
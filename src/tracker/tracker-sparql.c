@@ -22,9 +22,11 @@
 #include "config.h"
 
 #include <sys/param.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
 #include <locale.h>
+#include <unistd.h>
 
 #include <glib.h>
 #include <glib/gi18n.h>
@@ -1479,6 +1481,15 @@ tracker_sparql (int argc, const char **argv)
 	GError *error = NULL;
 	const gchar *failed;
 
+	/* Results print one small g_print per cell; when stdout is a
+	 * pipe or file that means a write syscall per fragment. Fully
+	 * buffer it so large exports go out in big writes. */
+	if (!isatty (STDOUT_FILENO)) {
+		static gchar stdout_buffer[65536];
+
+		setvbuf (stdout, stdout_buffer, _IOFBF, sizeof (stdout_buffer));
+	}
+
 	context = g_option_context_new (NULL);
 	g_option_context_add_main_entries (context, entries, NULL);
 
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2016, Red Hat Inc.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA
+ * 02110-1301, USA.
+ */
+
+/* Write path benchmark for libtracker-data: statement insert
+ * throughput, update buffer flush latency and commit cost. Not run
+ * as part of the test suite; numbers go to stdout.
+ *
+ *   ./tracker-data-benchmark [n-resources] [statements-per-resource]
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+
+#include <glib.h>
+
+#include <libtracker-data/tracker-data-manager.h>
+#include <libtracker-data/tracker-data-update.h>
+#include <libtracker-data/tracker-data.h>
+
+#define DEFAULT_N_RESOURCES 10000
+#define DEFAULT_N_STATEMENTS 8
+
+static void
+benchmark_inserts (gint n_resources,
+                   gint n_statements)
+{
+	GTimer *timer;
+	GError *error = NULL;
+	gdouble elapsed, max_flush = 0;
+	gint i, j;
+
+	timer = g_timer_new ();
+
+	tracker_data_begin_transaction (&error);
+	g_assert_no_error (error);
+
+	for (i = 0; i < n_resources; i++) {
+		gchar *subject;
+		GTimer *flush_timer = NULL;
+
+		subject = g_strdup_printf ("urn:bench:resource:%d", i);
+
+		tracker_data_insert_statement (NULL, subject,
+		                               "rdf:type", "nie:InformationElement",
+		                               &error);
+		g_assert_no_error (error);
+
+		for (j = 0; j < n_statements; j++) {
+			gchar *object;
+
+			object = g_strdup_printf ("Benchmark title %d-%d", i, j);
+			tracker_data_insert_statement (NULL, subject,
+			                               "nie:title", object,
+			                               &error);
+			g_assert_no_error (error);
+			g_free (object);
+		}
+
+		flush_timer = g_timer_new ();
+		tracker_data_update_buffer_might_flush (&error);
+		g_assert_no_error (error);
+		max_flush = MAX (max_flush, g_timer_elapsed (flush_timer, NULL));
+		g_timer_destroy (flush_timer);
+
+		g_free (subject);
+	}
+
+	tracker_data_commit_transaction (&error);
+	g_assert_no_error (error);
+
+	elapsed = g_timer_elapsed (timer, NULL);
+	g_timer_destroy (timer);
+
+	g_print ("inserted %d resources x %d statements in %.3fs "
+	         "(%.0f statements/s, worst flush %.3fs)\n",
+	         n_resources, n_statements, elapsed,
+	         (n_resources * (n_statements + 1)) / elapsed,
+	         max_flush);
+}
+
+int
+main (int argc, char *argv[])
+{
+	GError *error = NULL;
+	gchar *xdg_location;
+	gint n_resources = DEFAULT_N_RESOURCES;
+	gint n_statements = DEFAULT_N_STATEMENTS;
+
+	if (argc > 1)
+		n_resources = atoi (argv[1]);
+	if (argc > 2)
+		n_statements = atoi (argv[2]);
+
+	xdg_location = g_build_filename (g_get_tmp_dir (),
+	                                 "tracker-data-benchmark-XXXXXX",
+	                                 NULL);
+	if (!g_mkdtemp (xdg_location)) {
+		g_printerr ("Could not create temporary location\n");
+		return EXIT_FAILURE;
+	}
+
+	g_setenv ("XDG_DATA_HOME", xdg_location, TRUE);
+	g_setenv ("XDG_CACHE_HOME", xdg_location, TRUE);
+	g_setenv ("TRACKER_DB_ONTOLOGIES_DIR", TOP_SRCDIR "/src/ontologies/", TRUE);
+
+	tracker_db_journal_set_rotating (FALSE, G_MAXSIZE, NULL);
+
+	tracker_data_manager_init (TRACKER_DB_MANAGER_FORCE_REINDEX,
+	                           NULL,
+	                           NULL, FALSE, FALSE,
+	                           100, 100, NULL, NULL, NULL, &error);
+
+	if (error) {
+		g_printerr ("Could not initialize data manager: %s\n",
+		            error->message);
+		return EXIT_FAILURE;
+	}
+
+	benchmark_inserts (n_resources, n_statements);
+
+	tracker_data_manager_shutdown ();
+
+	g_free (xdg_location);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2016, Red Hat Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+/* Tokenizer benchmark: runs a corpus file (or a generated ASCII
+ * corpus when none is given) through the FTS parser configuration
+ * and reports tokens per second. Built next to the tests, not run
+ * as one.
+ *
+ *   ./tracker-parser-benchmark [corpus-file] [iterations]
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+
+#include <libtracker-common/tracker-common.h>
+
+#define DEFAULT_ITERATIONS 10
+#define GENERATED_CORPUS_WORDS 200000
+
+static gchar *
+generate_corpus (void)
+{
+	GString *str;
+	GRand *rand_;
+	gint i;
+
+	str = g_string_sized_new (GENERATED_CORPUS_WORDS * 8);
+	rand_ = g_rand_new_with_seed (42);
+
+	for (i = 0; i < GENERATED_CORPUS_WORDS; i++) {
+		gint len, j;
+
+		len = g_rand_int_range (rand_, 2, 12);
+		for (j = 0; j < len; j++) {
+			g_string_append_c (str, 'a' + g_rand_int_range (rand_, 0, 26));
+		}
+		g_string_append_c (str, ' ');
+	}
+
+	g_rand_free (rand_);
+
+	return g_string_free (str, FALSE);
+}
+
+int
+main (int argc, char *argv[])
+{
+	TrackerLanguage *language;
+	TrackerParser *parser;
+	GTimer *timer;
+	gchar *text = NULL;
+	gsize text_size;
+	gdouble elapsed;
+	guint64 n_tokens = 0;
+	gint iterations = DEFAULT_ITERATIONS;
+	gint i;
+
+	if (argc > 1) {
+		GError *error = NULL;
+
+		if (!g_file_get_contents (argv[1], &text, &text_size, &error)) {
+			g_printerr ("Could not read corpus '%s': %s\n",
+			            argv[1], error->message);
+			g_error_free (error);
+			return EXIT_FAILURE;
+		}
+	} else {
+		text = generate_corpus ();
+		text_size = strlen (text);
+	}
+
+	if (argc > 2)
+		iterations = atoi (argv[2]);
+
+	language = tracker_language_new (NULL);
+	parser = tracker_parser_new (language);
+
+	timer = g_timer_new ();
+
+	for (i = 0; i < iterations; i++) {
+		gint position, byte_start, byte_end, word_length;
+		gboolean stop_word;
+
+		tracker_parser_reset (parser, text, text_size,
+		                      30,    /* max word length */
+		                      FALSE, /* enable stemmer */
+		                      TRUE,  /* enable unaccent */
+		                      TRUE,  /* ignore stop words */
+		                      TRUE,  /* ignore reserved words */
+		                      TRUE); /* ignore numbers */
+
+		while (tracker_parser_next (parser, &position,
+		                            &byte_start, &byte_end,
+		                            &stop_word, &word_length)) {
+			if (!stop_word)
+				n_tokens++;
+		}
+	}
+
+	elapsed = g_timer_elapsed (timer, NULL);
+
+	g_print ("parsed %" G_GSIZE_FORMAT " bytes x %d iterations: "
+	         "%" G_GUINT64_FORMAT " tokens in %.3fs "
+	         "(%.0f tokens/s, %.1f MB/s)\n",
+	         text_size, iterations, n_tokens, elapsed,
+	         n_tokens / elapsed,
+	         (text_size * (gdouble) iterations) / (elapsed * 1024 * 1024));
+
+	tracker_parser_free (parser);
+	g_object_unref (language);
+	g_timer_destroy (timer);
+	g_free (text);
+
+	return EXIT_SUCCESS;
+}
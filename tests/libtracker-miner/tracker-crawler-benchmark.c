@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2016, Red Hat Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+/* Crawler benchmark: generates a synthetic tree and reports crawl
+ * throughput. Built alongside the tests, not run as one.
+ *
+ *   ./tracker-crawler-benchmark [depth] [dirs-per-dir] [files-per-dir]
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <gio/gio.h>
+
+#include <libtracker-miner/tracker-crawler.h>
+
+#define DEFAULT_DEPTH 4
+#define DEFAULT_DIRS_PER_DIR 8
+#define DEFAULT_FILES_PER_DIR 16
+
+typedef struct {
+	GMainLoop *main_loop;
+	guint directories_found;
+	guint files_found;
+} BenchmarkData;
+
+static guint
+generate_tree (const gchar *path,
+               gint         depth,
+               gint         dirs_per_dir,
+               gint         files_per_dir)
+{
+	guint created = 0;
+	gint i;
+
+	for (i = 0; i < files_per_dir; i++) {
+		gchar *file_path;
+
+		file_path = g_strdup_printf ("%s/file-%d.txt", path, i);
+		g_file_set_contents (file_path, "x", 1, NULL);
+		g_free (file_path);
+		created++;
+	}
+
+	if (depth > 0) {
+		for (i = 0; i < dirs_per_dir; i++) {
+			gchar *dir_path;
+
+			dir_path = g_strdup_printf ("%s/dir-%d", path, i);
+			g_mkdir (dir_path, 0700);
+			created += 1 + generate_tree (dir_path, depth - 1,
+			                              dirs_per_dir, files_per_dir);
+			g_free (dir_path);
+		}
+	}
+
+	return created;
+}
+
+static void
+crawler_directory_crawled_cb (TrackerCrawler *crawler,
+                              GFile          *directory,
+                              GNode          *tree,
+                              guint           directories_found,
+                              guint           directories_ignored,
+                              guint           files_found,
+                              guint           files_ignored,
+                              gpointer        user_data)
+{
+	BenchmarkData *data = user_data;
+
+	data->directories_found += directories_found;
+	data->files_found += files_found;
+}
+
+static void
+crawler_finished_cb (TrackerCrawler *crawler,
+                     gboolean        interrupted,
+                     gpointer        user_data)
+{
+	BenchmarkData *data = user_data;
+
+	g_main_loop_quit (data->main_loop);
+}
+
+int
+main (int argc, char *argv[])
+{
+	BenchmarkData data = { 0 };
+	TrackerCrawler *crawler;
+	GTimer *timer;
+	GFile *root;
+	gchar *root_path, *cleanup;
+	gdouble generate_elapsed, crawl_elapsed;
+	guint n_entries;
+	gint depth = DEFAULT_DEPTH;
+	gint dirs_per_dir = DEFAULT_DIRS_PER_DIR;
+	gint files_per_dir = DEFAULT_FILES_PER_DIR;
+
+	if (argc > 1)
+		depth = atoi (argv[1]);
+	if (argc > 2)
+		dirs_per_dir = atoi (argv[2]);
+	if (argc > 3)
+		files_per_dir = atoi (argv[3]);
+
+	root_path = g_build_filename (g_get_tmp_dir (),
+	                              "tracker-crawler-benchmark-XXXXXX",
+	                              NULL);
+	if (!g_mkdtemp (root_path)) {
+		g_printerr ("Could not create temporary tree\n");
+		return EXIT_FAILURE;
+	}
+
+	timer = g_timer_new ();
+	n_entries = generate_tree (root_path, depth, dirs_per_dir, files_per_dir);
+	generate_elapsed = g_timer_elapsed (timer, NULL);
+
+	g_print ("generated %u entries under %s in %.3fs\n",
+	         n_entries, root_path, generate_elapsed);
+
+	data.main_loop = g_main_loop_new (NULL, FALSE);
+
+	crawler = tracker_crawler_new (NULL);
+	g_signal_connect (crawler, "directory-crawled",
+	                  G_CALLBACK (crawler_directory_crawled_cb), &data);
+	g_signal_connect (crawler, "finished",
+	                  G_CALLBACK (crawler_finished_cb), &data);
+
+	root = g_file_new_for_path (root_path);
+
+	g_timer_start (timer);
+	tracker_crawler_start (crawler, root,
+	                       TRACKER_DIRECTORY_FLAG_RECURSE, -1);
+	g_main_loop_run (data.main_loop);
+	crawl_elapsed = g_timer_elapsed (timer, NULL);
+
+	g_print ("crawled %u directories, %u files in %.3fs (%.0f entries/s)\n",
+	         data.directories_found, data.files_found, crawl_elapsed,
+	         (data.directories_found + data.files_found) / crawl_elapsed);
+
+	g_object_unref (crawler);
+	g_object_unref (root);
+	g_main_loop_unref (data.main_loop);
+	g_timer_destroy (timer);
+
+	cleanup = g_strdup_printf ("rm -rf %s", root_path);
+	if (system (cleanup) != 0) {
+		g_printerr ("Could not clean up %s\n", root_path);
+	}
+	g_free (cleanup);
+	g_free (root_path);
+
+	return EXIT_SUCCESS;
+}
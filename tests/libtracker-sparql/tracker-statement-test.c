@@ -0,0 +1,281 @@
+/*
+ * Copyright (C) 2016, Red Hat Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA  02110-1301, USA.
+ */
+
+/* Tests for TrackerSparqlStatement placeholder binding: the applied
+ * query is captured through a mock connection whose query vfunc
+ * records the SPARQL and fails with a recognizable error.
+ */
+
+#include "config.h"
+
+#include <locale.h>
+#include <string.h>
+
+#include <libtracker-sparql/tracker-sparql.h>
+
+typedef struct {
+	TrackerSparqlConnection parent_instance;
+	gchar *last_sparql;
+} TestConnection;
+
+typedef struct {
+	TrackerSparqlConnectionClass parent_class;
+} TestConnectionClass;
+
+static GType test_connection_get_type (void);
+
+G_DEFINE_TYPE (TestConnection, test_connection, TRACKER_SPARQL_TYPE_CONNECTION)
+
+static TrackerSparqlCursor *
+test_connection_query (TrackerSparqlConnection  *self,
+                       const gchar              *sparql,
+                       GCancellable             *cancellable,
+                       GError                  **error)
+{
+	TestConnection *conn = (TestConnection *) self;
+
+	g_free (conn->last_sparql);
+	conn->last_sparql = g_strdup (sparql);
+
+	/* The applied query is all this connection cares about */
+	g_set_error (error,
+	             TRACKER_SPARQL_ERROR,
+	             TRACKER_SPARQL_ERROR_INTERNAL,
+	             "test connection has no results");
+	return NULL;
+}
+
+static void
+test_connection_finalize (GObject *object)
+{
+	TestConnection *conn = (TestConnection *) object;
+
+	g_free (conn->last_sparql);
+
+	G_OBJECT_CLASS (test_connection_parent_class)->finalize (object);
+}
+
+static void
+test_connection_class_init (TestConnectionClass *klass)
+{
+	G_OBJECT_CLASS (klass)->finalize = test_connection_finalize;
+	TRACKER_SPARQL_CONNECTION_CLASS (klass)->query = test_connection_query;
+}
+
+static void
+test_connection_init (TestConnection *conn)
+{
+}
+
+static TestConnection *
+create_connection (void)
+{
+	return g_object_new (test_connection_get_type (), NULL);
+}
+
+/* Executes @stmt expecting the mock connection error, and returns the
+ * SPARQL the statement applied. */
+static const gchar *
+execute_and_get_sparql (TestConnection         *conn,
+                        TrackerSparqlStatement *stmt)
+{
+	TrackerSparqlCursor *cursor;
+	GError *error = NULL;
+
+	cursor = tracker_sparql_statement_execute (stmt, NULL, &error);
+	g_assert_null (cursor);
+	g_assert_error (error, TRACKER_SPARQL_ERROR, TRACKER_SPARQL_ERROR_INTERNAL);
+	g_error_free (error);
+
+	g_assert_nonnull (conn->last_sparql);
+
+	return conn->last_sparql;
+}
+
+static void
+test_statement_bind_values (void)
+{
+	TestConnection *conn;
+	TrackerSparqlStatement *stmt;
+	GError *error = NULL;
+
+	conn = create_connection ();
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT ~str ~num ~yes ~frac ~ref { }",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+	g_assert_nonnull (stmt);
+
+	tracker_sparql_statement_bind_string (stmt, "str", "plain");
+	tracker_sparql_statement_bind_int (stmt, "num", 42);
+	tracker_sparql_statement_bind_boolean (stmt, "yes", TRUE);
+	tracker_sparql_statement_bind_double (stmt, "frac", 0.5);
+	tracker_sparql_statement_bind_iri (stmt, "ref", "urn:test:a");
+
+	g_assert_cmpstr (execute_and_get_sparql (conn, stmt), ==,
+	                 "SELECT \"plain\" 42 true 0.5 <urn:test:a> { }");
+
+	/* Re-binding one placeholder and executing again reuses the rest */
+	tracker_sparql_statement_bind_int (stmt, "num", -7);
+	g_assert_cmpstr (execute_and_get_sparql (conn, stmt), ==,
+	                 "SELECT \"plain\" -7 true 0.5 <urn:test:a> { }");
+
+	g_object_unref (stmt);
+	g_object_unref (conn);
+}
+
+static void
+test_statement_escaping (void)
+{
+	TestConnection *conn;
+	TrackerSparqlStatement *stmt;
+	GError *error = NULL;
+
+	conn = create_connection ();
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT ~v { }",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+
+	tracker_sparql_statement_bind_string (stmt, "v", "say \"hi\"\nbye");
+
+	g_assert_cmpstr (execute_and_get_sparql (conn, stmt), ==,
+	                 "SELECT \"say \\\"hi\\\"\\nbye\" { }");
+
+	g_object_unref (stmt);
+	g_object_unref (conn);
+}
+
+static void
+test_statement_quoted_and_comments (void)
+{
+	TestConnection *conn;
+	TrackerSparqlStatement *stmt;
+	GError *error = NULL;
+
+	conn = create_connection ();
+
+	/* '~' inside quoted strings (including with escaped quotes) and
+	 * inside comments must be passed through, not treated as a
+	 * placeholder */
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT \"~not\" '\\'~also' ~real { } # ~comment",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+
+	tracker_sparql_statement_bind_int (stmt, "real", 1);
+
+	g_assert_cmpstr (execute_and_get_sparql (conn, stmt), ==,
+	                 "SELECT \"~not\" '\\'~also' 1 { } # ~comment");
+
+	g_object_unref (stmt);
+	g_object_unref (conn);
+}
+
+static void
+test_statement_unterminated_quote (void)
+{
+	TestConnection *conn;
+	TrackerSparqlStatement *stmt;
+	GError *error = NULL;
+
+	conn = create_connection ();
+
+	/* An unterminated string swallows the rest of the template
+	 * verbatim; the (broken) query is passed through unchanged for
+	 * the parser to reject, not mangled or crashed on */
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT \"unterminated ~x",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+
+	g_assert_cmpstr (execute_and_get_sparql (conn, stmt), ==,
+	                 "SELECT \"unterminated ~x");
+
+	g_object_unref (stmt);
+	g_object_unref (conn);
+}
+
+static void
+test_statement_errors (void)
+{
+	TestConnection *conn;
+	TrackerSparqlStatement *stmt;
+	TrackerSparqlCursor *cursor;
+	GError *error = NULL;
+
+	conn = create_connection ();
+
+	/* Unbound placeholder */
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT ~unbound { }",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+
+	cursor = tracker_sparql_statement_execute (stmt, NULL, &error);
+	g_assert_null (cursor);
+	g_assert_error (error, TRACKER_SPARQL_ERROR, TRACKER_SPARQL_ERROR_PARSE);
+	g_clear_error (&error);
+
+	/* Bound, then cleared again */
+	tracker_sparql_statement_bind_int (stmt, "unbound", 5);
+	tracker_sparql_statement_clear_bindings (stmt);
+
+	cursor = tracker_sparql_statement_execute (stmt, NULL, &error);
+	g_assert_null (cursor);
+	g_assert_error (error, TRACKER_SPARQL_ERROR, TRACKER_SPARQL_ERROR_PARSE);
+	g_clear_error (&error);
+
+	g_object_unref (stmt);
+
+	/* Trailing '~' with no placeholder name */
+	stmt = tracker_sparql_connection_query_statement (TRACKER_SPARQL_CONNECTION (conn),
+	                                                  "SELECT 1 { } ~",
+	                                                  NULL, &error);
+	g_assert_no_error (error);
+
+	cursor = tracker_sparql_statement_execute (stmt, NULL, &error);
+	g_assert_null (cursor);
+	g_assert_error (error, TRACKER_SPARQL_ERROR, TRACKER_SPARQL_ERROR_PARSE);
+	g_clear_error (&error);
+
+	g_object_unref (stmt);
+	g_object_unref (conn);
+}
+
+gint
+main (gint argc, gchar **argv)
+{
+	setlocale (LC_ALL, "");
+
+	g_test_init (&argc, &argv, NULL);
+
+	g_test_add_func ("/libtracker-sparql/statement/bind-values",
+	                 test_statement_bind_values);
+	g_test_add_func ("/libtracker-sparql/statement/escaping",
+	                 test_statement_escaping);
+	g_test_add_func ("/libtracker-sparql/statement/quoted-and-comments",
+	                 test_statement_quoted_and_comments);
+	g_test_add_func ("/libtracker-sparql/statement/unterminated-quote",
+	                 test_statement_unterminated_quote);
+	g_test_add_func ("/libtracker-sparql/statement/errors",
+	                 test_statement_errors);
+
+	return g_test_run ();
+}